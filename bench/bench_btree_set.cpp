@@ -0,0 +1,72 @@
+#include "../datastruct/btree_set.cpp"
+#include "../datastruct/indexed_set.cpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+// BTreeSet against the pb_ds set from indexed_set.cpp: random inserts,
+// order_of_key, find_by_order and erases, plus BTreeSet's bulk load.
+// usage: bench_btree_set [n]
+int main(int argc, char** argv) {
+	int n = argc > 1 ? atoi(argv[1]) : 10000000;
+
+	mt19937 rng(42);
+	vector<int> keys(n);
+	for (auto& x : keys) x = rng() % (n / 2); // duplicates on purpose
+	vector<int> qs(n);
+	for (auto& x : qs) x = rng() % (n / 2);
+	auto ms = [](auto s, auto t) { return duration_cast<milliseconds>(t - s).count(); };
+	cout << "n = " << n << endl;
+
+	pbds::set<int> p; // pb_ds keys are {x, insertion time}, as in pbds::insert
+	BTreeSet<int> b;
+	long long c1 = 0, c2 = 0;
+	int t = 0;
+
+	// timing as in misc/timer.cpp
+	auto start = high_resolution_clock::now();
+	for (int x : keys) p.insert({x, t++});
+	auto mid = high_resolution_clock::now();
+	for (int x : keys) b.insert(x);
+	auto stop = high_resolution_clock::now();
+	cout << "insert:        pb_ds " << ms(start, mid) << " ms, BTreeSet " << ms(mid, stop) << " ms" << endl;
+
+	start = high_resolution_clock::now();
+	for (int x : qs) c1 += p.order_of_key({x, -pbds::INF});
+	mid = high_resolution_clock::now();
+	for (int x : qs) c2 += b.order_of_key(x);
+	stop = high_resolution_clock::now();
+	cout << "order_of_key:  pb_ds " << ms(start, mid) << " ms, BTreeSet " << ms(mid, stop) << " ms" << endl;
+
+	start = high_resolution_clock::now();
+	for (int x : qs) c1 += p.find_by_order(x)->first;
+	mid = high_resolution_clock::now();
+	for (int x : qs) c2 += b.find_by_order(x);
+	stop = high_resolution_clock::now();
+	cout << "find_by_order: pb_ds " << ms(start, mid) << " ms, BTreeSet " << ms(mid, stop) << " ms" << endl;
+
+	start = high_resolution_clock::now();
+	for (int i = 0; i < n / 2; ++i) p.erase(p.lower_bound({keys[i], -pbds::INF}));
+	mid = high_resolution_clock::now();
+	for (int i = 0; i < n / 2; ++i) b.erase(keys[i]);
+	stop = high_resolution_clock::now();
+	cout << "erase:         pb_ds " << ms(start, mid) << " ms, BTreeSet " << ms(mid, stop) << " ms" << endl;
+
+	sort(keys.begin(), keys.end());
+	start = high_resolution_clock::now();
+	BTreeSet<int> bulk(keys);
+	stop = high_resolution_clock::now();
+	cout << "bulk load:     BTreeSet " << ms(start, stop) << " ms" << endl;
+
+	if (c1 != c2 || int(p.size()) != b.size() || bulk.size() != n) {
+		cout << "MISMATCH" << endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,49 @@
+#include "../datastruct/cht.cpp"
+#include <bit>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+// DP-style interleaved add_line / query pairs: slopes non-increasing and
+// query points increasing. LiChao against both MonotoneCHT query modes.
+// usage: bench_cht [pairs]
+int main(int argc, char** argv) {
+	int n = argc > 1 ? atoi(argv[1]) : 10000000;
+
+	// tangents of y = -x^2 with some noise, so most lines stay on the hull
+	mt19937 rng(42);
+	vector<Line<ll>> lines;
+	lines.reserve(n);
+	for (ll i = 0; i < n; ++i) lines.emplace_back(-2 * i, i * i + ll(rng() % 4));
+	auto ms = [](auto s, auto t) { return duration_cast<milliseconds>(t - s).count(); };
+
+	vector<int> xs(n);
+	for (int i = 0; i < n; ++i) xs[i] = i;
+	LiChao<ll> lc(int(bit_ceil(unsigned(n))), xs); // needs a power of two
+	MonotoneCHT<ll> bin, mono;
+	ll s1 = 0, s2 = 0, s3 = 0;
+
+	// timing as in misc/timer.cpp
+	auto start = high_resolution_clock::now();
+	for (int i = 0; i < n; ++i) lc.add_line(lines[i]), s1 += lc.get_best(i);
+	auto t1 = high_resolution_clock::now();
+	for (int i = 0; i < n; ++i) bin.add_line(lines[i]), s2 += bin.get_best(i);
+	auto t2 = high_resolution_clock::now();
+	for (int i = 0; i < n; ++i) mono.add_line(lines[i]), s3 += mono.get_best_monotone(i);
+	auto t3 = high_resolution_clock::now();
+
+	cout << "pairs = " << n << ", hull size = " << mono.h.size() << endl;
+	cout << "LiChao:                        " << ms(start, t1) << " ms" << endl;
+	cout << "MonotoneCHT::get_best:         " << ms(t1, t2) << " ms" << endl;
+	cout << "MonotoneCHT::get_best_monotone: " << ms(t2, t3) << " ms" << endl;
+	if (s1 != s2 || s1 != s3) {
+		cout << "MISMATCH" << endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,57 @@
+#include "../datastruct/concurrent_dsu.cpp"
+#include "../datastruct/dsu.cpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+// DSU::merge against ConcurrentDSU::merge from 1 to max_threads threads.
+// usage: bench_concurrent_dsu [n] [m] [max_threads]
+int main(int argc, char** argv) {
+	int n = argc > 1 ? atoi(argv[1]) : 10000000;
+	int m = argc > 2 ? atoi(argv[2]) : 50000000;
+	int k = argc > 3 ? atoi(argv[3]) : max(1, int(thread::hardware_concurrency()));
+
+	mt19937 rng(42);
+	vector<pair<int, int>> edges(m);
+	for (auto& [x, y] : edges) x = rng() % n, y = rng() % n;
+
+	// timing as in misc/timer.cpp
+	auto start = high_resolution_clock::now();
+	DSU a(n);
+	int expect = 0;
+	for (auto [x, y] : edges) expect += a.merge(x, y);
+	auto stop = high_resolution_clock::now();
+	auto t_seq = duration_cast<milliseconds>(stop - start);
+	cout << "n = " << n << ", m = " << m << endl;
+	cout << "DSU:                " << t_seq.count() << " ms" << endl;
+
+	for (int t = 1; t <= k; t *= 2) {
+		ConcurrentDSU b(n);
+		vector<int> merged(t);
+		start = high_resolution_clock::now();
+		vector<thread> th;
+		for (int i = 0; i < t; ++i) {
+			th.emplace_back([&, i] {
+				int l = int(1LL * m * i / t), r = int(1LL * m * (i + 1) / t), c = 0;
+				for (int j = l; j < r; ++j) c += b.merge(edges[j].first, edges[j].second);
+				merged[i] = c;
+			});
+		}
+		for (auto& x : th) x.join();
+		stop = high_resolution_clock::now();
+		auto t_par = duration_cast<milliseconds>(stop - start);
+		int got = 0;
+		for (int c : merged) got += c;
+		cout << "ConcurrentDSU, " << t << " thread" << (t > 1 ? "s: " : ":  ") << t_par.count() << " ms, "
+		     << double(t_seq.count()) / max<long long>(1, t_par.count()) << "x";
+		cout << (got == expect ? "" : "  MISMATCH") << endl;
+		if (got != expect) return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,52 @@
+#include "../graph/connected_components.cpp"
+#include "../datastruct/dsu.cpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+// Sequential DSU::merge against connected_components on a random graph.
+// usage: bench_connected_components [n] [m] [threads]
+int main(int argc, char** argv) {
+	int n = argc > 1 ? atoi(argv[1]) : 10000000;
+	int m = argc > 2 ? atoi(argv[2]) : 100000000;
+	int threads = argc > 3 ? atoi(argv[3]) : 0;
+
+	mt19937 rng(42);
+	vector<pair<int, int>> edges(m);
+	for (auto& [x, y] : edges) x = rng() % n, y = rng() % n;
+
+	// timing as in misc/timer.cpp
+	auto start = high_resolution_clock::now();
+	DSU dsu(n);
+	for (auto [x, y] : edges) dsu.merge(x, y);
+	vector<int> id(n, -1), seq(n);
+	int cs = 0;
+	for (int i = 0; i < n; ++i) {
+		int r = dsu.root(i);
+		if (id[r] == -1) id[r] = cs++;
+		seq[i] = id[r];
+	}
+	auto stop = high_resolution_clock::now();
+	auto t_seq = duration_cast<milliseconds>(stop - start);
+
+	vector<int> label(n);
+	start = high_resolution_clock::now();
+	int cp = connected_components(n, edges, label, threads);
+	stop = high_resolution_clock::now();
+	auto t_par = duration_cast<milliseconds>(stop - start);
+
+	cout << "n = " << n << ", m = " << m << ", threads = " << (threads > 0 ? threads : int(thread::hardware_concurrency())) << endl;
+	cout << "DSU::merge:           " << t_seq.count() << " ms, " << cs << " components" << endl;
+	cout << "connected_components: " << t_par.count() << " ms, " << cp << " components" << endl;
+	cout << "speedup: " << double(t_seq.count()) / max<long long>(1, t_par.count()) << "x" << endl;
+	if (cs != cp || seq != label) {
+		cout << "MISMATCH" << endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,71 @@
+#include "../datastruct/fen.cpp"
+#include "../datastruct/rmq.cpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using ll = long long;
+
+// Scalar loops against FenTree::query_many and RMQ::argmin_many.
+// usage: bench_query_many [n_fen] [n_rmq] [queries] [threads]
+int main(int argc, char** argv) {
+	int nf = argc > 1 ? atoi(argv[1]) : 1 << 24;
+	int nr = argc > 2 ? atoi(argv[2]) : 4000000;
+	int q = argc > 3 ? atoi(argv[3]) : 10000000;
+	int threads = argc > 4 ? atoi(argv[4]) : max(1, int(thread::hardware_concurrency()));
+
+	mt19937 rng(42);
+	auto ms = [](auto a, auto b) { return duration_cast<milliseconds>(b - a).count(); };
+	auto report = [&](const char* what, long long t_scalar, long long t_batch, long long t_par) {
+		cout << what << ": scalar " << t_scalar << " ms, batch " << t_batch << " ms (" << double(t_scalar) / max(1LL, t_batch)
+		     << "x), " << threads << " threads " << t_par << " ms (" << double(t_scalar) / max(1LL, t_par) << "x)" << endl;
+	};
+
+	{
+		vector<ll> a(nf);
+		for (auto& x : a) x = rng() % 1000;
+		FenTree<ll> fen(a);
+		vector<int> idx(q);
+		for (auto& i : idx) i = rng() % (nf + 1);
+		vector<ll> s1(q), s2(q), s3(q);
+
+		// timing as in misc/timer.cpp
+		auto start = high_resolution_clock::now();
+		for (int i = 0; i < q; ++i) s1[i] = fen.query(idx[i]);
+		auto mid = high_resolution_clock::now();
+		fen.query_many(idx, s2);
+		auto stop = high_resolution_clock::now();
+		fen.query_many(idx, s3, threads);
+		auto par = high_resolution_clock::now();
+		cout << "n = " << nf << ", queries = " << q << endl;
+		report("FenTree::query", ms(start, mid), ms(mid, stop), ms(stop, par));
+		if (s1 != s2 || s1 != s3) return cout << "MISMATCH" << endl, 1;
+	}
+	{
+		vector<int> a(nr);
+		for (auto& x : a) x = rng();
+		RMQ<int> rmq(a);
+		vector<pair<int, int>> qs(q);
+		for (auto& [l, r] : qs) {
+			l = rng() % nr, r = rng() % nr;
+			if (l > r) swap(l, r);
+		}
+		vector<int> s1(q), s2(q), s3(q);
+
+		auto start = high_resolution_clock::now();
+		for (int i = 0; i < q; ++i) s1[i] = rmq.argmin(qs[i].first, qs[i].second);
+		auto mid = high_resolution_clock::now();
+		rmq.argmin_many(qs, s2);
+		auto stop = high_resolution_clock::now();
+		rmq.argmin_many(qs, s3, threads);
+		auto par = high_resolution_clock::now();
+		cout << "n = " << nr << ", queries = " << q << endl;
+		report("RMQ::argmin", ms(start, mid), ms(mid, stop), ms(stop, par));
+		if (s1 != s2 || s1 != s3) return cout << "MISMATCH" << endl, 1;
+	}
+	return 0;
+}
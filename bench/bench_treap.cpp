@@ -0,0 +1,55 @@
+#include "../datastruct/treap.cpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+// Treap::build against n merges, and the set operations with forking
+// disabled (d = max_depth()) against the default parallel recursion.
+// Nodes are never freed, as everywhere in treap.cpp.
+// usage: bench_treap [n]
+int main(int argc, char** argv) {
+	int n = argc > 1 ? atoi(argv[1]) : 5000000;
+
+	mt19937 gen(42);
+	auto ms = [](auto s, auto t) { return duration_cast<milliseconds>(t - s).count(); };
+	auto keys = [&](int step) {
+		vector<int> a;
+		for (int x = 0; int(a.size()) < n; x += 1 + gen() % step) a.push_back(x);
+		return a;
+	};
+	vector<int> x = keys(2), y = keys(3);
+
+	// timing as in misc/timer.cpp
+	auto start = high_resolution_clock::now();
+	Treap* t = nullptr;
+	for (int v : x) t = Treap::merge(t, new Treap(v));
+	auto mid = high_resolution_clock::now();
+	Treap* u = Treap::build(x);
+	auto stop = high_resolution_clock::now();
+	cout << "n = " << n << ", threads = " << thread::hardware_concurrency() << endl;
+	cout << "build: merges " << ms(start, mid) << " ms, Treap::build " << ms(mid, stop) << " ms" << endl;
+	if (Treap::size(t) != n || Treap::size(u) != n) return cout << "MISMATCH" << endl, 1;
+
+	int D = Treap::max_depth();
+	auto run = [&](const char* what, auto op) {
+		Treap *a1 = Treap::build(x), *b1 = Treap::build(y), *a2 = Treap::build(x), *b2 = Treap::build(y);
+		auto s = high_resolution_clock::now();
+		Treap* r1 = op(a1, b1, D);
+		auto m = high_resolution_clock::now();
+		Treap* r2 = op(a2, b2, 0);
+		auto e = high_resolution_clock::now();
+		cout << what << ": sequential " << ms(s, m) << " ms, parallel " << ms(m, e) << " ms, result size " << Treap::size(r1)
+		     << endl;
+		return Treap::size(r1) == Treap::size(r2);
+	};
+	bool ok = run("unite", [](Treap* a, Treap* b, int d) { return Treap::unite(a, b, d); });
+	ok &= run("intersect", [](Treap* a, Treap* b, int d) { return Treap::intersect(a, b, d); });
+	ok &= run("difference", [](Treap* a, Treap* b, int d) { return Treap::difference(a, b, d); });
+	if (!ok) return cout << "MISMATCH" << endl, 1;
+	return 0;
+}
@@ -0,0 +1,84 @@
+#include "../datastruct/wide_seg_tree.cpp"
+#include "../datastruct/seg_tree.cpp"
+#include "../datastruct/rmq.cpp"
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+using ll = long long;
+
+struct Sum {
+	using T = ll;
+	static constexpr T I = 0;
+	static T f(T a, T b) { return a + b; }
+};
+struct Min {
+	using T = int;
+	static constexpr T I = INT_MAX;
+	static T f(T a, T b) { return min(a, b); }
+};
+
+// WideTree against Tree<T> (range sum, point updates) and RMQ (range min).
+// usage: bench_wide_seg_tree [n] [ops]
+int main(int argc, char** argv) {
+	int n = argc > 1 ? atoi(argv[1]) : 10000000;
+	int q = argc > 2 ? atoi(argv[2]) : 10000000;
+
+	mt19937 rng(42);
+	auto ms = [](auto a, auto b) { return duration_cast<milliseconds>(b - a).count(); };
+	vector<pair<int, int>> qs(q); // [l, r)
+	for (auto& [l, r] : qs) {
+		l = rng() % n, r = rng() % n;
+		if (l > r) swap(l, r);
+		r++;
+	}
+	vector<pair<int, int>> upd(q);
+	for (auto& [k, x] : upd) k = rng() % n, x = rng() % 1000;
+	cout << "n = " << n << ", ops = " << q << endl;
+
+	{
+		vector<ll> a(n);
+		for (auto& x : a) x = rng() % 1000;
+		Tree<ll> bin(a, 0, [](ll x, ll y) { return x + y; });
+		WideTree<Sum> wide(a);
+		ll s1 = 0, s2 = 0;
+
+		// timing as in misc/timer.cpp
+		auto start = high_resolution_clock::now();
+		for (auto [l, r] : qs) s1 += bin.query(l, r);
+		auto mid = high_resolution_clock::now();
+		for (auto [l, r] : qs) s2 += wide.query(l, r);
+		auto stop = high_resolution_clock::now();
+		cout << "sum query:  Tree " << ms(start, mid) << " ms, WideTree " << ms(mid, stop) << " ms" << endl;
+		if (s1 != s2) return cout << "MISMATCH" << endl, 1;
+
+		start = high_resolution_clock::now();
+		for (auto [k, x] : upd) bin.change(k, x);
+		mid = high_resolution_clock::now();
+		for (auto [k, x] : upd) wide.change(k, x);
+		stop = high_resolution_clock::now();
+		cout << "sum change: Tree " << ms(start, mid) << " ms, WideTree " << ms(mid, stop) << " ms" << endl;
+		if (bin.query(0, n) != wide.query(0, n)) return cout << "MISMATCH" << endl, 1;
+	}
+	{
+		vector<int> a(n);
+		for (auto& x : a) x = rng();
+		RMQ<int> rmq(a);
+		WideTree<Min> wide(a);
+		ll s1 = 0, s2 = 0;
+
+		auto start = high_resolution_clock::now();
+		for (auto [l, r] : qs) s1 += rmq.getmin(l, r - 1);
+		auto mid = high_resolution_clock::now();
+		for (auto [l, r] : qs) s2 += wide.query(l, r);
+		auto stop = high_resolution_clock::now();
+		cout << "min query:  RMQ " << ms(start, mid) << " ms, WideTree " << ms(mid, stop) << " ms" << endl;
+		if (s1 != s2) return cout << "MISMATCH" << endl, 1;
+	}
+	return 0;
+}
@@ -0,0 +1,47 @@
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <vector>
+using namespace std;
+
+// Hybrid RMQ: sparse table over minima of blocks of B elements, stored
+// in one flat buffer; partial blocks are scanned. n + (n / B) log n
+// memory, queries are O(B) with a vectorizable scan. argmin returns the
+// leftmost minimum.
+template<class T, class Comparator = less<T>, int B = 32>
+struct BlockRMQ {
+	vector<T> v;
+	int m, lg;
+	vector<int> spr; // level j is spr[j * m, (j + 1) * m)
+
+	int Comp(int i, int j) {
+		return Comparator()(v[j], v[i]) ? j : i;
+	}
+	int scan(int l, int r) { // [l, r]
+		T x = v[l];
+		for (int i = l + 1; i <= r; ++i) x = min(x, v[i], Comparator());
+		while (Comparator()(x, v[l])) ++l;
+		return l;
+	}
+
+	BlockRMQ(const vector<T>& v) : v(v), m((int(v.size()) + B - 1) / B), lg(max(1, int(bit_width(unsigned(m))))), spr(m * lg) {
+		int n = int(v.size());
+		for (int i = 0; i < m; ++i) spr[i] = scan(i * B, min(n, i * B + B) - 1);
+		for (int j = 1; j < lg; ++j) {
+			for (int i = 0; i + (1 << j) <= m; ++i) {
+				spr[j * m + i] = Comp(spr[(j - 1) * m + i], spr[(j - 1) * m + i + (1 << (j - 1))]);
+			}
+		}
+	}
+	int argmin(int l, int r) { // [l, r]
+		int bl = l / B, br = r / B;
+		if (bl == br) return scan(l, r);
+		int ret = scan(l, bl * B + B - 1);
+		if (bl + 1 < br) {
+			int d = bit_width(unsigned(br - bl - 1)) - 1;
+			ret = Comp(ret, Comp(spr[d * m + bl + 1], spr[d * m + br - (1 << d)]));
+		}
+		return Comp(ret, scan(br * B, r));
+	}
+	T getmin(int l, int r) { return v[argmin(l, r)]; }
+};
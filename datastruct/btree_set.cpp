@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <vector>
+using namespace std;
+
+// Order-statistics multiset as a B+-tree: leaves hold up to B sorted keys,
+// inner nodes hold the subtree size and maximum key of every child.
+// Deletion is relaxed: nodes are dropped once empty but never rebalanced.
+template<class T, int B = 32>
+struct BTreeSet {
+	struct Node {
+		int n = 0;
+		bool leaf = true;
+		T key[B]; // leaf: the keys, inner: max key of each child
+		int ch[B], cnt[B];
+	};
+	vector<Node> t;
+	vector<int> fre;
+	int root, total = 0;
+
+	BTreeSet() : root(alloc(true)) {}
+	// a must be sorted, O(n)
+	BTreeSet(const vector<T>& a) {
+		const int F = B * 3 / 4;
+		vector<int> lvl;
+		for (int i = 0; i < (int)a.size(); i += F) {
+			int v = alloc(true), k = min(F, (int)a.size() - i);
+			copy(a.begin() + i, a.begin() + i + k, t[v].key);
+			t[v].n = k;
+			lvl.push_back(v);
+		}
+		while (lvl.size() > 1) {
+			vector<int> up;
+			for (int i = 0; i < (int)lvl.size(); i += F) {
+				int v = alloc(false);
+				for (int j = i; j < min(i + F, (int)lvl.size()); ++j) put(v, j - i, lvl[j]);
+				up.push_back(v);
+			}
+			lvl.swap(up);
+		}
+		root = lvl.empty() ? alloc(true) : lvl[0];
+		total = a.size();
+	}
+
+	int alloc(bool leaf) {
+		int v;
+		if (!fre.empty()) {
+			v = fre.back();
+			fre.pop_back();
+		} else {
+			v = t.size();
+			t.emplace_back();
+		}
+		t[v].n = 0;
+		t[v].leaf = leaf;
+		return v;
+	}
+	int weight(int v) const {
+		if (t[v].leaf) return t[v].n;
+		int s = 0;
+		for (int i = 0; i < t[v].n; ++i) s += t[v].cnt[i];
+		return s;
+	}
+	const T& last(int v) const { return t[v].key[t[v].n - 1]; }
+	// first child whose max is >= x, or the last child
+	int child(int v, const T& x) const {
+		int i = 0;
+		while (i < t[v].n - 1 && t[v].key[i] < x) ++i;
+		return i;
+	}
+	// make c the i-th child of inner node v
+	void put(int v, int i, int c) {
+		Node& a = t[v];
+		for (int j = a.n; j > i; --j) {
+			a.key[j] = a.key[j - 1], a.ch[j] = a.ch[j - 1], a.cnt[j] = a.cnt[j - 1];
+		}
+		a.key[i] = last(c), a.ch[i] = c, a.cnt[i] = weight(c);
+		a.n++;
+	}
+	int split(int v) {
+		int w = alloc(t[v].leaf), h = B / 2;
+		Node &a = t[v], &b = t[w];
+		b.n = B - h;
+		copy(a.key + h, a.key + B, b.key);
+		if (!a.leaf) {
+			copy(a.ch + h, a.ch + B, b.ch);
+			copy(a.cnt + h, a.cnt + B, b.cnt);
+		}
+		a.n = h;
+		return w;
+	}
+	// returns the new right sibling if v was split, else -1
+	int ins(int v, const T& x) {
+		if (t[v].leaf) {
+			Node& a = t[v];
+			int i = a.n;
+			for (; i > 0 && x < a.key[i - 1]; --i) a.key[i] = a.key[i - 1];
+			a.key[i] = x;
+			a.n++;
+		} else {
+			int i = child(v, x), c = t[v].ch[i], s = ins(c, x);
+			t[v].cnt[i]++;
+			t[v].key[i] = last(c);
+			if (s != -1) {
+				t[v].cnt[i] = weight(c);
+				put(v, i + 1, s);
+			}
+		}
+		return t[v].n == B ? split(v) : -1;
+	}
+	// -1 if x is missing, else whether v became empty
+	int del(int v, const T& x) {
+		Node& a = t[v];
+		if (a.leaf) {
+			int i = 0;
+			while (i < a.n && a.key[i] < x) ++i;
+			if (i == a.n || x < a.key[i]) return -1;
+			copy(a.key + i + 1, a.key + a.n, a.key + i);
+			a.n--;
+		} else {
+			int i = child(v, x), r = del(a.ch[i], x);
+			if (r == -1) return -1;
+			if (r == 1) {
+				fre.push_back(a.ch[i]);
+				copy(a.key + i + 1, a.key + a.n, a.key + i);
+				copy(a.ch + i + 1, a.ch + a.n, a.ch + i);
+				copy(a.cnt + i + 1, a.cnt + a.n, a.cnt + i);
+				a.n--;
+			} else {
+				a.cnt[i]--;
+				a.key[i] = last(a.ch[i]);
+			}
+		}
+		return a.n == 0;
+	}
+
+	int size() const { return total; }
+	bool empty() const { return total == 0; }
+	void insert(const T& x) {
+		total++;
+		int s = ins(root, x);
+		if (s != -1) {
+			int r = alloc(false);
+			put(r, 0, root);
+			put(r, 1, s);
+			root = r;
+		}
+	}
+	// removes one copy of x
+	bool erase(const T& x) {
+		int r = del(root, x);
+		if (r == -1) return false;
+		total--;
+		if (r == 1) t[root].leaf = true;
+		while (!t[root].leaf && t[root].n == 1) {
+			fre.push_back(root);
+			root = t[root].ch[0];
+		}
+		return true;
+	}
+	// number of keys < x, or <= x if le
+	int order_of_key(const T& x, bool le = false) const {
+		auto lt = [&](const T& a) { return le ? !(x < a) : a < x; };
+		int res = 0, v = root;
+		while (!t[v].leaf) {
+			const Node& a = t[v];
+			int i = 0;
+			while (i < a.n - 1 && lt(a.key[i])) res += a.cnt[i++];
+			v = a.ch[i];
+		}
+		int i = 0;
+		while (i < t[v].n && lt(t[v].key[i])) ++i;
+		return res + i;
+	}
+	// k-th smallest, 0-indexed, k < size()
+	const T& find_by_order(int k) const {
+		int v = root;
+		while (!t[v].leaf) {
+			int i = 0;
+			while (k >= t[v].cnt[i]) k -= t[v].cnt[i++];
+			v = t[v].ch[i];
+		}
+		return t[v].key[k];
+	}
+	int count(const T& x) const { return order_of_key(x, true) - order_of_key(x); }
+};
@@ -0,0 +1,37 @@
+#include "lichao.cpp"
+
+// Convex hull trick for minimum, lines added in non-increasing slope
+// order. get_best is O(log n); get_best_monotone is O(1) amortized when
+// the query x's are non-decreasing. Intersections compare in __int128.
+template<class T>
+struct MonotoneCHT {
+	vector<Line<T>> h;
+	int ptr = 0;
+
+	// b is useless if a and c meet no later than a and b
+	static bool bad(const Line<T>& a, const Line<T>& b, const Line<T>& c) {
+		return ((__int128)c.b - a.b) * ((__int128)a.a - b.a) <= ((__int128)b.b - a.b) * ((__int128)a.a - c.a);
+	}
+	void add_line(Line<T> f) {
+		if (!h.empty() && h.back().a == f.a) {
+			if (h.back().b <= f.b) return;
+			h.pop_back();
+		}
+		while (h.size() >= 2 && bad(h[h.size() - 2], h.back(), f)) h.pop_back();
+		h.push_back(f);
+		ptr = min(ptr, int(h.size()) - 1);
+	}
+	T get_best(T x) { // hull must be non-empty
+		int l = 0, r = int(h.size()) - 1;
+		while (l < r) {
+			int m = (l + r) / 2;
+			if (h[m](x) <= h[m + 1](x)) r = m;
+			else l = m + 1;
+		}
+		return h[l](x);
+	}
+	T get_best_monotone(T x) { // x must not decrease between calls
+		while (ptr + 1 < int(h.size()) && h[ptr + 1](x) <= h[ptr](x)) ++ptr;
+		return h[ptr](x);
+	}
+};
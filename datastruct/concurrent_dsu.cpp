@@ -0,0 +1,43 @@
+#include <atomic>
+#include <utility>
+#include <vector>
+
+// Lock-free DSU, safe to call from many threads at once.
+// Roots are linked by index (larger under smaller) with a CAS,
+// root() does path halving with a CAS that may fail harmlessly.
+// No sizes: they cannot be kept exact without a lock.
+struct ConcurrentDSU {
+	std::vector<std::atomic<int>> f;
+
+	ConcurrentDSU(int n) : f(n) {
+		for (int i = 0; i < n; ++i) f[i].store(i, std::memory_order_relaxed);
+	}
+	int root(int x) {
+		for (;;) {
+			int p = f[x].load(std::memory_order_acquire);
+			if (p == x) return x;
+			int g = f[p].load(std::memory_order_acquire);
+			if (p != g) f[x].compare_exchange_weak(p, g, std::memory_order_release, std::memory_order_relaxed);
+			x = g;
+		}
+	}
+	bool same(int x, int y) {
+		for (;;) {
+			x = root(x);
+			y = root(y);
+			if (x == y) return true;
+			// x may have been linked under someone after we found it
+			if (f[x].load(std::memory_order_acquire) == x) return false;
+		}
+	}
+	bool merge(int x, int y) {
+		for (;;) {
+			x = root(x);
+			y = root(y);
+			if (x == y) return false;
+			if (x > y) std::swap(x, y);
+			int e = y;
+			if (f[y].compare_exchange_strong(e, x, std::memory_order_acq_rel)) return true;
+		}
+	}
+};
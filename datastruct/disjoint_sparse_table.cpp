@@ -0,0 +1,33 @@
+#include <algorithm>
+#include <bit>
+#include <vector>
+using namespace std;
+
+// Disjoint sparse table: O(1) range folds with exactly one combine for
+// any associative f (M as in MonoidTree, I is not used).
+// O(n log n) build into one flat buffer.
+template<class M>
+struct DisjointSparseTable {
+	using T = typename M::T;
+	int n;
+	vector<T> a, t; // level j is t[j * n, (j + 1) * n)
+
+	DisjointSparseTable(const vector<T>& v) : n(int(v.size())), a(v) {
+		int lg = n > 1 ? bit_width(unsigned(n - 1)) : 0;
+		t.resize(size_t(lg) * n);
+		for (int j = 0; j < lg; ++j) {
+			T* s = t.data() + size_t(j) * n;
+			for (int mid = 1 << j; mid < n; mid += 2 << j) {
+				s[mid - 1] = a[mid - 1];
+				for (int i = mid - 2; i >= mid - (1 << j); --i) s[i] = M::f(a[i], s[i + 1]);
+				s[mid] = a[mid];
+				for (int i = mid + 1; i < min(n, mid + (1 << j)); ++i) s[i] = M::f(s[i - 1], a[i]);
+			}
+		}
+	}
+	T query(int l, int r) { // [l, r]
+		if (l == r) return a[l];
+		int j = bit_width(unsigned(l ^ r)) - 1;
+		return M::f(t[size_t(j) * n + l], t[size_t(j) * n + r]);
+	}
+};
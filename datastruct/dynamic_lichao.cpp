@@ -0,0 +1,74 @@
+#include "lichao.cpp"
+
+// Li Chao tree over an integer range [lo, hi] with nodes allocated on
+// demand, so no query points are needed up front. Minimum queries.
+// add_line O(log C), add_segment O(log^2 C), get_best O(log C).
+template<class T>
+struct DynamicLiChao {
+	const T INF = numeric_limits<T>::max() >> 2;
+	struct Node {
+		Line<T> f;
+		int l, r;
+	};
+	T lo, hi;
+	vector<Node> p;
+
+	int make() {
+		p.push_back({Line<T>(0, INF), 0, 0});
+		return int(p.size()) - 1;
+	}
+	void add(int s, T x, T y, Line<T> f) { // node s covers [x, y]
+		for (;;) {
+			T m = x + (y - x) / 2;
+			bool bl = f(x) < p[s].f(x), bm = f(m) < p[s].f(m);
+			if (bm) swap(f, p[s].f);
+			if (x == y) return;
+			if (bl != bm) {
+				if (!p[s].l) {
+					int c = make();
+					p[s].l = c;
+				}
+				s = p[s].l, y = m;
+			} else {
+				if (!p[s].r) {
+					int c = make();
+					p[s].r = c;
+				}
+				s = p[s].r, x = m + 1;
+			}
+		}
+	}
+	void add_segment(int s, T x, T y, Line<T> f, T l, T r) {
+		if (r < x || y < l) return;
+		if (l <= x && y <= r) return add(s, x, y, f);
+		T m = x + (y - x) / 2;
+		if (!p[s].l) {
+			int c = make();
+			p[s].l = c;
+		}
+		if (!p[s].r) {
+			int c = make();
+			p[s].r = c;
+		}
+		add_segment(p[s].l, x, m, f, l, r);
+		add_segment(p[s].r, m + 1, y, f, l, r);
+	}
+
+	DynamicLiChao(T lo, T hi) : lo(lo), hi(hi) {
+		make(), make(); // null node, root
+	}
+	void add_line(Line<T> f) { add(1, lo, hi, f); }
+	void add_segment(Line<T> f, T l, T r) { // only on x in [l, r]
+		add_segment(1, lo, hi, f, l, r);
+	}
+	T get_best(T x) {
+		T ret = INF, a = lo, b = hi;
+		for (int s = 1; s;) {
+			ret = min(ret, p[s].f(x));
+			T m = a + (b - a) / 2;
+			if (x <= m) s = p[s].l, b = m;
+			else s = p[s].r, a = m + 1;
+		}
+		return ret;
+	}
+};
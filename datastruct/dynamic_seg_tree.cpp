@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <vector>
+using namespace std;
+using ll = long long;
+
+// Range add, range sum over [lo, hi) for huge coordinate ranges.
+// Nodes are created on demand in a pool with 32-bit child indices,
+// O(log C) new nodes per change. The lazy add stays on its node
+// (never pushed down), so queries never allocate.
+// T must hold sums over the whole range, use __int128 if needed.
+template<class T = ll>
+struct DynamicSegTree {
+	struct Node {
+		int l = 0, r = 0; // 0 is null
+		T sum = 0, add = 0;
+	};
+	ll lo, hi;
+	vector<Node> p;
+
+	int make() {
+		p.emplace_back();
+		return int(p.size()) - 1;
+	}
+	T query(int s, ll l, ll r, ll x, ll y) {
+		if (s == 0 || y <= l || r <= x) return 0;
+		if (l <= x && y <= r) return p[s].sum;
+		ll m = x + (y - x) / 2;
+		return p[s].add * (min(r, y) - max(l, x)) + query(p[s].l, l, r, x, m) + query(p[s].r, l, r, m, y);
+	}
+	void change(int s, ll l, ll r, ll x, ll y, T k) {
+		p[s].sum += k * (min(r, y) - max(l, x));
+		if (l <= x && y <= r) {
+			p[s].add += k;
+			return;
+		}
+		ll m = x + (y - x) / 2;
+		if (l < m) {
+			if (p[s].l == 0) {
+				int c = make();
+				p[s].l = c;
+			}
+			change(p[s].l, l, r, x, m, k);
+		}
+		if (m < r) {
+			if (p[s].r == 0) {
+				int c = make();
+				p[s].r = c;
+			}
+			change(p[s].r, l, r, m, y, k);
+		}
+	}
+
+	DynamicSegTree(ll lo, ll hi, int reserve = 0) : lo(lo), hi(hi) {
+		p.reserve(reserve + 2);
+		reset();
+	}
+	// clears the tree, keeping the pool's memory for reuse
+	void reset() {
+		p.clear();
+		make(), make(); // null node, root
+	}
+	T query(ll l, ll r) { // [l, r)
+		return l < r ? query(1, l, r, lo, hi) : 0;
+	}
+	void change(ll l, ll r, T k) { // [l, r)
+		if (l < r) change(1, l, r, lo, hi, k);
+	}
+};
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+using namespace std;
+
+// Set of integers in [0, n) as a 64-ary tree of bit words.
+// Bit j of seg[h][i] says whether word 64i + j of level h - 1 is non-empty;
+// cnt[h][i] is the number of elements under seg[h][i].
+// insert/erase/next/prev: O(log_64 n), rank/kth: O(64 log_64 n)
+struct FastSet {
+	int n, lg, sz = 0;
+	vector<vector<uint64_t>> seg;
+	vector<vector<int>> cnt;
+
+	FastSet(int n_) : n(n_) {
+		int m = n;
+		do {
+			m = (m + 63) >> 6;
+			seg.emplace_back(m);
+			cnt.emplace_back(m);
+		} while (m > 1);
+		lg = seg.size();
+	}
+	int size() const { return sz; }
+	bool contains(int x) const { return seg[0][x >> 6] >> (x & 63) & 1; }
+	bool insert(int x) {
+		if (contains(x)) return false;
+		for (int h = 0; h < lg; ++h, x >>= 6) {
+			seg[h][x >> 6] |= 1ULL << (x & 63);
+			cnt[h][x >> 6]++;
+		}
+		sz++;
+		return true;
+	}
+	bool erase(int x) {
+		if (!contains(x)) return false;
+		bool clear = true;
+		for (int h = 0; h < lg; ++h, x >>= 6) {
+			if (clear) seg[h][x >> 6] &= ~(1ULL << (x & 63));
+			clear = seg[h][x >> 6] == 0;
+			cnt[h][x >> 6]--;
+		}
+		sz--;
+		return true;
+	}
+	// smallest element >= x, or -1
+	int next(int x) const {
+		x = max(x, 0);
+		if (x >= n) return -1;
+		for (int h = 0; h < lg; ++h) {
+			if ((x >> 6) >= (int)seg[h].size()) return -1;
+			uint64_t d = seg[h][x >> 6] >> (x & 63);
+			if (d == 0) {
+				x = (x >> 6) + 1;
+				continue;
+			}
+			x += countr_zero(d);
+			for (int g = h - 1; g >= 0; --g) x = x << 6 | countr_zero(seg[g][x]);
+			return x;
+		}
+		return -1;
+	}
+	// largest element <= x, or -1
+	int prev(int x) const {
+		x = min(x, n - 1);
+		for (int h = 0; h < lg && x >= 0; ++h) {
+			uint64_t d = seg[h][x >> 6] << (63 - (x & 63));
+			if (d == 0) {
+				x = (x >> 6) - 1;
+				continue;
+			}
+			x -= countl_zero(d);
+			for (int g = h - 1; g >= 0; --g) x = x << 6 | (63 - countl_zero(seg[g][x]));
+			return x;
+		}
+		return -1;
+	}
+	// number of elements < x
+	int rank(int x) const {
+		if (x >= n) return sz;
+		if (x <= 0) return 0;
+		int res = popcount(seg[0][x >> 6] & ((1ULL << (x & 63)) - 1));
+		x >>= 6;
+		for (int h = 1; h < lg; ++h, x >>= 6) {
+			res += accumulate(cnt[h - 1].begin() + (x & ~63), cnt[h - 1].begin() + x, 0);
+		}
+		return res;
+	}
+	// k-th smallest element, 0-indexed, or -1
+	int kth(int k) const {
+		if (k < 0 || k >= sz) return -1;
+		int x = 0;
+		for (int h = lg - 1; h > 0; --h) {
+			x <<= 6;
+			while (k >= cnt[h - 1][x]) k -= cnt[h - 1][x++];
+		}
+		uint64_t w = seg[0][x];
+		while (k--) w &= w - 1;
+		return x << 6 | countr_zero(w);
+	}
+};
@@ -1,4 +1,6 @@
 #include <bit>
+#include <span>
+#include <thread>
 #include <vector>
 using namespace std;
 
@@ -8,6 +10,11 @@ struct FenTree {
 	vector<T> tree;
 
 	FenTree(int n) : tree(n, {}) {}
+	FenTree(const vector<T>& a) : tree(a) { // O(n) build
+		for (int i = 0; i < int(tree.size()); ++i) {
+			if ((i | (i + 1)) < int(tree.size())) tree[i | (i + 1)] += tree[i];
+		}
+	}
 	void update(int i, T d) { // a[i] += dif
 		for (; i < int(tree.size()); i |= i + 1) tree[i] += d;
 	}
@@ -16,6 +23,22 @@ struct FenTree {
 		for (; r > 0; r &= r - 1) ret += tree[r - 1];
 		return ret;
 	}
+	// out[i] = query(idx[i]), optionally split across threads. The nodes of a
+	// query depend only on its index, so the loads of consecutive queries
+	// already overlap; software prefetching measured slower.
+	void query_many(span<const int> idx, span<T> out, int threads = 1) {
+		if (threads > 1) {
+			vector<thread> th;
+			size_t m = idx.size();
+			for (int t = 0; t < threads; ++t) {
+				size_t l = m * t / threads, r = m * (t + 1) / threads;
+				th.emplace_back([=, this] { query_many(idx.subspan(l, r - l), out.subspan(l, r - l)); });
+			}
+			for (auto& t : th) t.join();
+			return;
+		}
+		for (size_t i = 0; i < idx.size(); ++i) out[i] = query(idx[i]);
+	}
 	// returns min pos such that sum of [0, pos] >= sum
 	// n if no sum is >= sum
 	// -1 if empty sum is.
@@ -30,3 +53,39 @@ struct FenTree {
 		return pos;
 	}
 };
+
+// Range add, range sum with two Fenwick trees:
+// sum of [0, r) = r * b1.query(r) - b2.query(r)
+template <typename T>
+struct RangeFenTree {
+	FenTree<T> b1, b2;
+
+	RangeFenTree(int n) : b1(n), b2(n) {}
+	RangeFenTree(const vector<T>& a) : b1(int(a.size())), b2(neg(a)) {}
+	static vector<T> neg(vector<T> a) {
+		for (auto& x : a) x = -x;
+		return a;
+	}
+	void update(int l, int r, T d) { // a[i] += d for i \in [l, r)
+		b1.update(l, d);
+		b1.update(r, -d);
+		b2.update(l, d * l);
+		b2.update(r, -d * r);
+	}
+	T query(int r) { // \sum_{i \in [0, r)} a[i]
+		return b1.query(r) * r - b2.query(r);
+	}
+	T query(int l, int r) { return query(r) - query(l); } // [l, r)
+	// same as FenTree::lower_bound, needs a[i] >= 0
+	int lower_bound(T sum) {
+		if (sum <= 0) return -1;
+		int n = int(b1.tree.size()), pos = 0;
+		T s1 = 0, s2 = 0;
+		for (int bit = 1 << (std::bit_width((unsigned)n) - 1); bit; bit >>= 1) {
+			if (pos + bit > n) continue;
+			T t1 = s1 + b1.tree[pos + bit - 1], t2 = s2 + b2.tree[pos + bit - 1];
+			if (t1 * (pos + bit) - t2 < sum) pos += bit, s1 = t1, s2 = t2;
+		}
+		return pos;
+	}
+};
@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+using namespace std;
+
+#include "../misc/compress.cpp"
+
+// Offline 2D Fenwick tree over a fixed point set.
+// Fenwick node i over compressed x keeps the sorted y's of its points,
+// all nodes packed into one arena. O(n log n) memory, O(log^2 n) ops.
+template<class C, class T>
+struct FenTree2D {
+	int n;
+	vector<C> xs, ys;
+	vector<int> start; // node i owns [start[i], start[i + 1]) of ys and tree
+	vector<T> tree;
+
+	FenTree2D(const vector<pair<C, C>>& pts) : n(int(pts.size())), xs(n), start(n + 1) {
+		for (int i = 0; i < n; ++i) xs[i] = pts[i].first;
+		vector<int> rx = compress(xs);
+		sort(xs.begin(), xs.end());
+		for (int i = 0; i < n; ++i) {
+			for (int k = rx[i]; k < n; k |= k + 1) ++start[k + 1];
+		}
+		for (int i = 0; i < n; ++i) start[i + 1] += start[i];
+		ys.resize(start[n]);
+		vector<int> pos(start.begin(), start.end() - 1);
+		for (int i = 0; i < n; ++i) {
+			for (int k = rx[i]; k < n; k |= k + 1) ys[pos[k]++] = pts[i].second;
+		}
+		for (int i = 0; i < n; ++i) sort(ys.begin() + start[i], ys.begin() + start[i + 1]);
+		tree.assign(ys.size(), {});
+	}
+	void update(C x, C y, T d) { // a[(x, y)] += d, (x, y) must be one of the points
+		int k = int(lower_bound(xs.begin(), xs.end(), x) - xs.begin());
+		for (; k < n; k |= k + 1) {
+			auto b = ys.begin() + start[k], e = ys.begin() + start[k + 1];
+			int len = int(e - b);
+			for (int j = int(lower_bound(b, e, y) - b); j < len; j |= j + 1) tree[start[k] + j] += d;
+		}
+	}
+	T query(C x, C y) { // sum of points with x' < x and y' < y
+		T ret = 0;
+		int k = int(lower_bound(xs.begin(), xs.end(), x) - xs.begin());
+		for (; k > 0; k &= k - 1) {
+			auto b = ys.begin() + start[k - 1], e = ys.begin() + start[k];
+			for (int j = int(lower_bound(b, e, y) - b); j > 0; j &= j - 1) ret += tree[start[k - 1] + j - 1];
+		}
+		return ret;
+	}
+	T query(C x1, C y1, C x2, C y2) { // [x1, x2) x [y1, y2)
+		return query(x2, y2) - query(x1, y2) - query(x2, y1) + query(x1, y1);
+	}
+};
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+using namespace std;
+
+// Polynomial hash mod the Mersenne prime 2^61 - 1: one 128-bit product
+// and a shift-and-add fold per character instead of two ModInt products.
+namespace hasher61 {
+	using hash_t = uint64_t;
+	const hash_t MOD = (1ULL << 61) - 1;
+
+	// a * b + c mod MOD, for a, b < MOD
+	hash_t mad(hash_t a, hash_t b, hash_t c) {
+		__uint128_t p = __uint128_t(a) * b + c;
+		hash_t r = (hash_t(p) & MOD) + hash_t(p >> 61);
+		return r >= MOD ? r - MOD : r;
+	}
+	hash_t sub(hash_t a, hash_t b) { return a >= b ? a - b : a + MOD - b; }
+
+	mt19937_64 rng(chrono::steady_clock::now().time_since_epoch().count());
+	const hash_t base = uniform_int_distribution<hash_t>(1ULL << 40, MOD - 1)(rng);
+
+	template<class T>
+	hash_t calc(const T& x) {
+		hash_t r = 0;
+		for (auto& u : x) r = mad(r, base, hash_t(u));
+		return r;
+	}
+
+	// h[0..|x|] = hashes of the prefixes of x; h needs room for |x| + 1 values
+	template<class T>
+	void calc_prefix(const T& x, hash_t* h) {
+		h[0] = 0;
+		int n = x.size();
+		for (int i = 0; i < n; ++i) h[i + 1] = mad(h[i], base, hash_t(x[i]));
+	}
+
+	template<class T>
+	vector<hash_t> calc_vector(const T& x) {
+		vector<hash_t> r(x.size() + 1);
+		calc_prefix(x, r.data());
+		return r;
+	}
+
+	// calc_prefix(xs[j], h[j]) for all j. 128-bit products do not vectorize,
+	// so L strings are advanced in lockstep to keep L independent chains in flight.
+	template<class T, int L = 4>
+	void calc_prefix_many(const vector<T>& xs, const vector<hash_t*>& h) {
+		int m = xs.size();
+		for (int j0 = 0; j0 < m; j0 += L) {
+			int k = min(L, m - j0), n = xs[j0].size();
+			for (int l = 0; l < k; ++l) {
+				h[j0 + l][0] = 0;
+				n = min(n, int(xs[j0 + l].size()));
+			}
+			for (int i = 0; i < n; ++i) {
+				for (int l = 0; l < k; ++l) {
+					h[j0 + l][i + 1] = mad(h[j0 + l][i], base, hash_t(xs[j0 + l][i]));
+				}
+			}
+			for (int l = 0; l < k; ++l) {
+				const T& x = xs[j0 + l];
+				hash_t* p = h[j0 + l];
+				for (int i = n; i < int(x.size()); ++i) p[i + 1] = mad(p[i], base, hash_t(x[i]));
+			}
+		}
+	}
+
+	vector<hash_t> pows {1};
+
+	void ensure_pows(int n) {
+		while (int(pows.size()) <= n) pows.push_back(mad(pows.back(), base, 0));
+	}
+
+	hash_t range(const hash_t* k, int l, int r) { // [l, r)
+		ensure_pows(r - l);
+		return sub(k[r], mad(k[l], pows[r - l], 0));
+	}
+	hash_t range(const vector<hash_t>& k, int l, int r) { return range(k.data(), l, r); }
+} // namespace hasher61
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+using namespace std;
+using ll = long long;
+
+// Implicit treap over a sequence, nodes in one pool with 32-bit
+// indices (0 is null). Lazy reverse, add and assign, subtree sum and
+// min. split/merge are iterative; reset() reuses the pool.
+template<class T = ll>
+struct ImplicitTreap {
+	struct Node {
+		int l, r, sz;
+		unsigned prior;
+		T v, sum, mn, add, asg;
+		bool has_asg, rev;
+	};
+	vector<Node> p;
+	vector<int> stk;
+	mt19937 rng{unsigned(chrono::steady_clock::now().time_since_epoch().count())};
+	int root = 0;
+
+	void apply_rev(int x) {
+		if (!x) return;
+		swap(p[x].l, p[x].r);
+		p[x].rev ^= 1;
+	}
+	void apply_asg(int x, T c) {
+		if (!x) return;
+		p[x].v = p[x].mn = p[x].asg = c;
+		p[x].sum = c * p[x].sz;
+		p[x].has_asg = true;
+		p[x].add = 0;
+	}
+	void apply_add(int x, T d) {
+		if (!x) return;
+		p[x].v += d, p[x].mn += d, p[x].add += d;
+		p[x].sum += d * p[x].sz;
+	}
+	void push(int x) {
+		auto& n = p[x];
+		if (n.rev) apply_rev(n.l), apply_rev(n.r), n.rev = false;
+		if (n.has_asg) apply_asg(n.l, n.asg), apply_asg(n.r, n.asg), n.has_asg = false;
+		if (n.add != 0) apply_add(n.l, n.add), apply_add(n.r, n.add), n.add = 0;
+	}
+	void pull(int x) {
+		auto &n = p[x], &a = p[n.l], &b = p[n.r];
+		n.sz = a.sz + 1 + b.sz;
+		n.sum = a.sum + n.v + b.sum;
+		n.mn = min({a.mn, n.v, b.mn});
+	}
+	void pull_path() {
+		for (int i = int(stk.size()) - 1; i >= 0; --i) pull(stk[i]);
+	}
+
+	ImplicitTreap(int reserve = 0) {
+		p.reserve(reserve + 1);
+		reset();
+	}
+	void reset() {
+		p.assign(1, {0, 0, 0, 0, 0, 0, numeric_limits<T>::max(), 0, 0, false, false});
+		root = 0;
+	}
+	int make(T v) {
+		p.push_back({0, 0, 1, unsigned(rng()), v, v, v, 0, 0, false, false});
+		return int(p.size()) - 1;
+	}
+	// {first k elements, rest}
+	pair<int, int> split(int t, int k) {
+		int a = 0, b = 0, *pa = &a, *pb = &b;
+		stk.clear();
+		while (t) {
+			push(t);
+			stk.push_back(t);
+			int ls = p[p[t].l].sz;
+			if (ls < k) {
+				*pa = t, pa = &p[t].r, k -= ls + 1, t = p[t].r;
+			} else {
+				*pb = t, pb = &p[t].l, t = p[t].l;
+			}
+		}
+		*pa = *pb = 0;
+		pull_path();
+		return {a, b};
+	}
+	int merge(int a, int b) {
+		int ret = 0, *pr = &ret;
+		stk.clear();
+		while (a && b) {
+			if (p[a].prior > p[b].prior) {
+				push(a), stk.push_back(a);
+				*pr = a, pr = &p[a].r, a = p[a].r;
+			} else {
+				push(b), stk.push_back(b);
+				*pr = b, pr = &p[b].l, b = p[b].l;
+			}
+		}
+		*pr = a ? a : b;
+		pull_path();
+		return ret;
+	}
+	// runs f on the node holding [l, r) of the sequence
+	template<class F>
+	void with(int l, int r, F f) {
+		auto [a, bc] = split(root, l);
+		auto [b, c] = split(bc, r - l);
+		f(b);
+		root = merge(merge(a, b), c);
+	}
+
+	int size() { return p[root].sz; }
+	void insert(int pos, T v) {
+		auto [a, b] = split(root, pos);
+		int x = make(v);
+		root = merge(merge(a, x), b);
+	}
+	void erase(int pos) { // the node stays in the pool until reset()
+		auto [a, bc] = split(root, pos);
+		root = merge(a, split(bc, 1).second);
+	}
+	// all on [l, r)
+	void reverse(int l, int r) { with(l, r, [&](int x) { apply_rev(x); }); }
+	void add(int l, int r, T d) { with(l, r, [&](int x) { apply_add(x, d); }); }
+	void assign(int l, int r, T c) { with(l, r, [&](int x) { apply_asg(x, c); }); }
+	T range_sum(int l, int r) {
+		T ret;
+		with(l, r, [&](int x) { ret = p[x].sum; });
+		return ret;
+	}
+	T range_min(int l, int r) {
+		T ret;
+		with(l, r, [&](int x) { ret = p[x].mn; });
+		return ret;
+	}
+	vector<T> to_vector() { // in-order, iterative
+		vector<T> ret;
+		stk.clear();
+		for (int x = root; x || !stk.empty();) {
+			if (x) {
+				push(x), stk.push_back(x), x = p[x].l;
+			} else {
+				x = stk.back(), stk.pop_back();
+				ret.push_back(p[x].v), x = p[x].r;
+			}
+		}
+		return ret;
+	}
+};
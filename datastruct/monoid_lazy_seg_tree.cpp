@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <bit>
+#include <vector>
+using namespace std;
+
+// Non-recursive lazy segment tree over a value monoid M (as in
+// MonoidTree) and an action monoid A:
+// struct A { using F = ...; static constexpr F I = ...;
+//	static F f(F a, F b); // a after b
+//	static M::T apply(F a, M::T x); };
+// Values live in 2n slots, lazies in n, for any n (no rounding up).
+// A node's value already includes its own lazy, so pushes and pulls only
+// run along the root paths of the two boundary leaves.
+// source: atcoder library, codeforces.com/blog/entry/18051
+template<class M, class A>
+struct LazyTree {
+	using T = typename M::T;
+	using F = typename A::F;
+	int n, h;
+	vector<T> t;
+	vector<F> lz;
+
+	void pull(int k) { t[k] = A::apply(lz[k], M::f(t[k * 2], t[k * 2 + 1])); }
+	void apply(int k, F a) {
+		t[k] = A::apply(a, t[k]);
+		if (k < n) lz[k] = A::f(a, lz[k]);
+	}
+	void push(int k) {
+		apply(k * 2, lz[k]);
+		apply(k * 2 + 1, lz[k]);
+		lz[k] = A::I;
+	}
+	void push_path(int p) { // ancestors of leaf p, from the top
+		for (int s = h; s > 0; --s) {
+			if (p >> s) push(p >> s);
+		}
+	}
+	void pull_path(int p) {
+		while (p >>= 1) pull(p);
+	}
+
+	LazyTree(int n) : n(n), h(bit_width(unsigned(n))), t(n * 2, M::I), lz(n, A::I) {}
+	LazyTree(const vector<T>& a) : LazyTree(int(a.size())) { // O(n) build
+		copy(a.begin(), a.end(), t.begin() + n);
+		for (int k = n - 1; k > 0; --k) pull(k);
+	}
+	void set(int p, T x) {
+		p += n;
+		push_path(p);
+		t[p] = x;
+		pull_path(p);
+	}
+	T get(int p) {
+		p += n;
+		push_path(p);
+		return t[p];
+	}
+	T query(int l, int r) { // [l, r)
+		if (l == r) return M::I;
+		l += n, r += n;
+		push_path(l);
+		push_path(r - 1);
+		T ra = M::I, rb = M::I;
+		for (; l < r; l /= 2, r /= 2) {
+			if (l & 1) ra = M::f(ra, t[l++]);
+			if (r & 1) rb = M::f(t[--r], rb);
+		}
+		return M::f(ra, rb);
+	}
+	void change(int l, int r, F a) { // [l, r)
+		if (l == r) return;
+		l += n, r += n;
+		push_path(l);
+		push_path(r - 1);
+		for (int x = l, y = r; x < y; x /= 2, y /= 2) {
+			if (x & 1) apply(x++, a);
+			if (y & 1) apply(--y, a);
+		}
+		pull_path(l);
+		pull_path(r - 1);
+	}
+};
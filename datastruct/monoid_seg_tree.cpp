@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <bit>
+#include <utility>
+#include <vector>
+using namespace std;
+
+// Segment tree over a monoid given at compile time, so f is inlined:
+// struct M { using T = ...; static constexpr T I = ...; static T f(T a, T b); };
+// Any n; f need not be commutative. Queries are const and thread-safe.
+// source: own, atcoder library (max_right, min_left)
+template<class M>
+struct MonoidTree {
+	using T = typename M::T;
+	int n, sz;
+	vector<T> t;
+
+	MonoidTree(int n) : n(n), sz(int(bit_ceil(unsigned(max(n, 1))))), t(sz * 2, M::I) {}
+	MonoidTree(const vector<T>& a) : MonoidTree(int(a.size())) { // O(n) build
+		copy(a.begin(), a.end(), t.begin() + sz);
+		for (int k = sz - 1; k > 0; --k) t[k] = M::f(t[k * 2], t[k * 2 + 1]);
+	}
+
+	void change(int k, T x) {
+		k += sz;
+		t[k] = x;
+		while (k /= 2) t[k] = M::f(t[k * 2], t[k * 2 + 1]);
+	}
+	// Sets t[k] = x for each (k, x), then recomputes every dirty
+	// internal node once, level by level from the bottom
+	void change_many(const vector<pair<int, T>>& upd) {
+		vector<int> d;
+		for (auto& [k, x] : upd) {
+			t[k + sz] = x;
+			d.push_back((k + sz) / 2);
+		}
+		sort(d.begin(), d.end());
+		d.erase(unique(d.begin(), d.end()), d.end());
+		while (!d.empty() && d[0] > 0) {
+			for (int k : d) t[k] = M::f(t[k * 2], t[k * 2 + 1]);
+			int m = 0;
+			for (int k : d) {
+				if (m == 0 || d[m - 1] != k / 2) d[m++] = k / 2;
+			}
+			d.resize(m);
+		}
+	}
+	T get(int k) const { return t[k + sz]; }
+	T query(int a, int b) const { // [a, b)
+		T ra = M::I, rb = M::I;
+		for (a += sz, b += sz; a < b; a /= 2, b /= 2) {
+			if (a & 1) ra = M::f(ra, t[a++]);
+			if (b & 1) rb = M::f(t[--b], rb);
+		}
+		return M::f(ra, rb);
+	}
+	// max r such that g(query(l, r)), g must be monotone and g(I) true
+	template<class G>
+	int max_right(int l, G g) const {
+		if (l == n) return n;
+		l += sz;
+		T s = M::I;
+		do {
+			while (l % 2 == 0) l /= 2;
+			if (!g(M::f(s, t[l]))) {
+				while (l < sz) {
+					l *= 2;
+					if (g(M::f(s, t[l]))) s = M::f(s, t[l++]);
+				}
+				return l - sz;
+			}
+			s = M::f(s, t[l++]);
+		} while ((l & -l) != l);
+		return n;
+	}
+	// min l such that g(query(l, r)), g must be monotone and g(I) true
+	template<class G>
+	int min_left(int r, G g) const {
+		if (r == 0) return 0;
+		r += sz;
+		T s = M::I;
+		do {
+			--r;
+			while (r > 1 && r % 2) r /= 2;
+			if (!g(M::f(t[r], s))) {
+				while (r < sz) {
+					r = r * 2 + 1;
+					if (g(M::f(t[r], s))) s = M::f(t[r--], s);
+				}
+				return r + 1 - sz;
+			}
+			s = M::f(t[r], s);
+		} while ((r & -r) != r);
+		return 0;
+	}
+};
@@ -1,10 +1,27 @@
+#include <array>
 #include <deque>
 using namespace std;
 
-template<class T, class Compare>
+// Fixed-capacity deque without allocations, CAP must be a power of 2
+// and larger than the window. Use as the D parameter of MonotonicQueue:
+// MonotonicQueue<int, less<int>, RingDeque<pair<int, int>, 1 << 10>>
+template<class T, int CAP>
+struct RingDeque {
+	array<T, CAP> a;
+	unsigned b = 0, e = 0;
+
+	bool empty() { return b == e; }
+	T& front() { return a[b & (CAP - 1)]; }
+	T& back() { return a[(e - 1) & (CAP - 1)]; }
+	void push_back(T x) { a[e++ & (CAP - 1)] = x; }
+	void pop_back() { --e; }
+	void pop_front() { ++b; }
+};
+
+template<class T, class Compare, class D = deque<pair<T, int>>>
 struct MonotonicQueue {
 	int l = 0, r = 0;
-	deque<pair<T, int>> d;
+	D d;
 
 	void push(T x) {
 		while (!d.empty() && !Compare()(d.back().first, x)) {
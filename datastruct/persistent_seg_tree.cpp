@@ -0,0 +1,80 @@
+#include <vector>
+using namespace std;
+using ll = long long;
+
+// Persistent sum segment tree by path copying. All versions share one
+// arena of nodes linked by index; node 0 is the empty tree.
+// O(log n) new nodes per update, O(n) build.
+template<class T = ll>
+struct PersistentTree {
+	struct Node {
+		int l, r;
+		T sum;
+	};
+	int n;
+	vector<Node> p{{0, 0, 0}};
+	vector<int> roots; // roots[v] is version v
+
+	int make(int l, int r, T sum) {
+		p.push_back({l, r, sum});
+		return int(p.size()) - 1;
+	}
+	int build(const vector<T>& a, int x, int y) {
+		if (y - x == 1) return make(0, 0, a[x]);
+		int m = (x + y) / 2;
+		int l = build(a, x, m), r = build(a, m, y);
+		return make(l, r, p[l].sum + p[r].sum);
+	}
+	int change(int s, int x, int y, int k, T d) {
+		if (y - x == 1) return make(0, 0, p[s].sum + d);
+		int m = (x + y) / 2;
+		int l = p[s].l, r = p[s].r;
+		if (k < m) l = change(l, x, m, k, d);
+		else r = change(r, m, y, k, d);
+		return make(l, r, p[l].sum + p[r].sum);
+	}
+	T query(int s, int x, int y, int l, int r) {
+		if (s == 0 || y <= l || r <= x) return 0;
+		if (l <= x && y <= r) return p[s].sum;
+		int m = (x + y) / 2;
+		return query(p[s].l, x, m, l, r) + query(p[s].r, m, y, l, r);
+	}
+	int copy(vector<Node>& q, vector<int>& id, int s) {
+		if (s == 0 || id[s] >= 0) return s == 0 ? 0 : id[s];
+		int l = copy(q, id, p[s].l), r = copy(q, id, p[s].r);
+		q.push_back({l, r, p[s].sum});
+		return id[s] = int(q.size()) - 1;
+	}
+
+	PersistentTree(int n) : n(n), roots{0} {}
+	PersistentTree(const vector<T>& a) : n(int(a.size())), roots{a.empty() ? 0 : build(a, 0, n)} {}
+	// new version = version v with a[k] += d, returns its number
+	int update(int v, int k, T d) {
+		roots.push_back(change(roots[v], 0, n, k, d));
+		return int(roots.size()) - 1;
+	}
+	T query(int v, int l, int r) { // [l, r) in version v
+		return query(roots[v], 0, n, l, r);
+	}
+	// min i such that sum of [0, i] in version v minus version u is > k,
+	// n if none. With counts of values this is the k-th smallest (0-indexed).
+	int kth(int u, int v, T k) {
+		int a = roots[u], b = roots[v], x = 0, y = n;
+		if (p[b].sum - p[a].sum <= k) return n;
+		while (y - x > 1) {
+			int m = (x + y) / 2;
+			T left = p[p[b].l].sum - p[p[a].l].sum;
+			if (k < left) a = p[a].l, b = p[b].l, y = m;
+			else k -= left, a = p[a].r, b = p[b].r, x = m;
+		}
+		return x;
+	}
+	// drops every version not in keep, keep[i] becomes version i
+	void compact(const vector<int>& keep) {
+		vector<Node> q{{0, 0, 0}};
+		vector<int> id(p.size(), -1), nr;
+		for (int v : keep) nr.push_back(copy(q, id, roots[v]));
+		p.swap(q);
+		roots.swap(nr);
+	}
+};
@@ -2,6 +2,9 @@
 #include <functional>
 #include <iostream>
 #include <numeric>
+#include <span>
+#include <thread>
+#include <utility>
 #include <vector>
 #define sz(x) ((int)(x).size())
 using namespace std;
@@ -31,4 +34,27 @@ struct RMQ {
 		return Comp(spr[d][l], spr[d][r - (1 << d) + 1]);
 	}
 	T getmin(int l, int r) { return v[argmin(l, r)]; }
+	// out[i] = argmin(q[i]), prefetching the table rows a few queries ahead
+	void argmin_many(span<const pair<int, int>> q, span<int> out, int threads = 1) {
+		if (threads > 1) {
+			vector<thread> th;
+			size_t m = q.size();
+			for (int t = 0; t < threads; ++t) {
+				size_t l = m * t / threads, r = m * (t + 1) / threads;
+				th.emplace_back([=, this] { argmin_many(q.subspan(l, r - l), out.subspan(l, r - l)); });
+			}
+			for (auto& t : th) t.join();
+			return;
+		}
+		const size_t D = 8;
+		for (size_t i = 0; i < q.size(); ++i) {
+			if (i + D < q.size()) {
+				auto [l, r] = q[i + D];
+				int d = std::bit_width((unsigned)(r - l + 1)) - 1;
+				__builtin_prefetch(&spr[d][l]);
+				__builtin_prefetch(&spr[d][r - (1 << d) + 1]);
+			}
+			out[i] = argmin(q[i].first, q[i].second);
+		}
+	}
 };
@@ -0,0 +1,38 @@
+#include <utility>
+#include <vector>
+
+// DSU with undo: union by size, no path compression, O(log n) per op.
+// snapshot() returns a time that rollback() can later return to.
+struct RollbackDSU {
+	std::vector<int> f, siz;
+	std::vector<int> hist; // roots that got a new parent
+
+	RollbackDSU(int n) : f(n), siz(n, 1) {
+		for (int i = 0; i < n; ++i) f[i] = i;
+	}
+	int root(int x) {
+		while (x != f[x]) x = f[x];
+		return x;
+	}
+	bool same(int x, int y) { return root(x) == root(y); }
+	bool merge(int x, int y) {
+		x = root(x);
+		y = root(y);
+		if (x == y) return false;
+		if (siz[x] < siz[y]) std::swap(x, y);
+		siz[x] += siz[y];
+		f[y] = x;
+		hist.push_back(y);
+		return true;
+	}
+	int size(int x) { return siz[root(x)]; }
+	int snapshot() { return int(hist.size()); }
+	void rollback(int t) {
+		while (int(hist.size()) > t) {
+			int y = hist.back();
+			hist.pop_back();
+			siz[f[y]] -= siz[y];
+			f[y] = y;
+		}
+	}
+};
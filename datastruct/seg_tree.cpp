@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <bit>
 #include <functional>
+#include <utility>
 #include <vector>
 using namespace std;
 
@@ -12,12 +15,36 @@ struct Tree {
 	vector<T> t;
 
 	Tree(int n, T I, function<T(T, T)> f) : n(n), I(I), f(f), t(n * 2, I) {}
+	// O(n) build, size is rounded up to a power of 2
+	Tree(const vector<T>& a, T I, function<T(T, T)> f) : Tree(int(bit_ceil(max<size_t>(a.size(), 1))), I, f) {
+		copy(a.begin(), a.end(), t.begin() + n);
+		for (int k = n - 1; k > 0; --k) t[k] = f(t[k * 2], t[k * 2 + 1]);
+	}
 
 	void change(int k, T x) {
 		k += n;
 		t[k] = x;
 		while (k /= 2) t[k] = f(t[k * 2], t[k * 2 + 1]);
 	}
+	// Sets t[k] = x for each (k, x), then recomputes every dirty
+	// internal node once, level by level from the bottom
+	void change_many(const vector<pair<int, T>>& upd) {
+		vector<int> d;
+		for (auto& [k, x] : upd) {
+			t[k + n] = x;
+			d.push_back((k + n) / 2);
+		}
+		sort(d.begin(), d.end());
+		d.erase(unique(d.begin(), d.end()), d.end());
+		while (!d.empty() && d[0] > 0) {
+			for (int k : d) t[k] = f(t[k * 2], t[k * 2 + 1]);
+			int m = 0;
+			for (int k : d) {
+				if (m == 0 || d[m - 1] != k / 2) d[m++] = k / 2;
+			}
+			d.resize(m);
+		}
+	}
 	T query(int a, int b) { // [a, b)
 		T r = I;
 		static T buf[128];
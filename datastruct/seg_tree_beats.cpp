@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <limits>
+#include <vector>
+using namespace std;
+using ll = long long;
+
+// Segment tree beats (Ji): range chmin, chmax, add and range sum,
+// amortized O(log^2 n). Node fields are stored struct-of-arrays.
+// source: Ji Ruyi, own
+struct SegTreeBeats {
+	const ll INF = numeric_limits<ll>::max() / 4;
+	int n;
+	vector<ll> mx1, mx2, mn1, mn2, sum, lz;
+	vector<int> mxc, mnc;
+
+	void leaf(int s, ll v) {
+		mx1[s] = mn1[s] = sum[s] = v;
+		mx2[s] = -INF, mn2[s] = INF;
+		mxc[s] = mnc[s] = 1;
+	}
+	void pull(int s) {
+		int a = s * 2, b = s * 2 + 1;
+		sum[s] = sum[a] + sum[b];
+		if (mx1[a] == mx1[b]) mx1[s] = mx1[a], mxc[s] = mxc[a] + mxc[b], mx2[s] = max(mx2[a], mx2[b]);
+		else if (mx1[a] > mx1[b]) mx1[s] = mx1[a], mxc[s] = mxc[a], mx2[s] = max(mx2[a], mx1[b]);
+		else mx1[s] = mx1[b], mxc[s] = mxc[b], mx2[s] = max(mx1[a], mx2[b]);
+		if (mn1[a] == mn1[b]) mn1[s] = mn1[a], mnc[s] = mnc[a] + mnc[b], mn2[s] = min(mn2[a], mn2[b]);
+		else if (mn1[a] < mn1[b]) mn1[s] = mn1[a], mnc[s] = mnc[a], mn2[s] = min(mn2[a], mn1[b]);
+		else mn1[s] = mn1[b], mnc[s] = mnc[b], mn2[s] = min(mn1[a], mn2[b]);
+	}
+	void apply_add(int s, int len, ll x) {
+		sum[s] += x * len;
+		mx1[s] += x, mn1[s] += x;
+		if (mx2[s] != -INF) mx2[s] += x;
+		if (mn2[s] != INF) mn2[s] += x;
+		lz[s] += x;
+	}
+	void apply_chmin(int s, ll x) { // needs mx2 < x
+		if (mx1[s] <= x) return;
+		sum[s] -= (mx1[s] - x) * mxc[s];
+		if (mn1[s] == mx1[s]) mn1[s] = x;
+		else if (mn2[s] == mx1[s]) mn2[s] = x;
+		mx1[s] = x;
+	}
+	void apply_chmax(int s, ll x) { // needs mn2 > x
+		if (mn1[s] >= x) return;
+		sum[s] += (x - mn1[s]) * mnc[s];
+		if (mx1[s] == mn1[s]) mx1[s] = x;
+		else if (mx2[s] == mn1[s]) mx2[s] = x;
+		mn1[s] = x;
+	}
+	void push(int s, int x, int y) {
+		int m = (x + y) / 2;
+		if (lz[s] != 0) {
+			apply_add(s * 2, m - x, lz[s]);
+			apply_add(s * 2 + 1, y - m, lz[s]);
+			lz[s] = 0;
+		}
+		for (int c : {s * 2, s * 2 + 1}) {
+			apply_chmin(c, mx1[s]);
+			apply_chmax(c, mn1[s]);
+		}
+	}
+	void build(const vector<ll>& a, int s, int x, int y) {
+		if (y - x == 1) return leaf(s, a[x]);
+		int m = (x + y) / 2;
+		build(a, s * 2, x, m);
+		build(a, s * 2 + 1, m, y);
+		pull(s);
+	}
+	void chmin(int s, int x, int y, int l, int r, ll v) {
+		if (y <= l || r <= x || mx1[s] <= v) return;
+		if (l <= x && y <= r && mx2[s] < v) return apply_chmin(s, v);
+		push(s, x, y);
+		int m = (x + y) / 2;
+		chmin(s * 2, x, m, l, r, v);
+		chmin(s * 2 + 1, m, y, l, r, v);
+		pull(s);
+	}
+	void chmax(int s, int x, int y, int l, int r, ll v) {
+		if (y <= l || r <= x || mn1[s] >= v) return;
+		if (l <= x && y <= r && mn2[s] > v) return apply_chmax(s, v);
+		push(s, x, y);
+		int m = (x + y) / 2;
+		chmax(s * 2, x, m, l, r, v);
+		chmax(s * 2 + 1, m, y, l, r, v);
+		pull(s);
+	}
+	void add(int s, int x, int y, int l, int r, ll v) {
+		if (y <= l || r <= x) return;
+		if (l <= x && y <= r) return apply_add(s, y - x, v);
+		push(s, x, y);
+		int m = (x + y) / 2;
+		add(s * 2, x, m, l, r, v);
+		add(s * 2 + 1, m, y, l, r, v);
+		pull(s);
+	}
+	ll query(int s, int x, int y, int l, int r) {
+		if (y <= l || r <= x) return 0;
+		if (l <= x && y <= r) return sum[s];
+		push(s, x, y);
+		int m = (x + y) / 2;
+		return query(s * 2, x, m, l, r) + query(s * 2 + 1, m, y, l, r);
+	}
+
+	SegTreeBeats(const vector<ll>& a) : n(int(a.size())), mx1(n * 4), mx2(n * 4), mn1(n * 4), mn2(n * 4), sum(n * 4), lz(n * 4), mxc(n * 4), mnc(n * 4) {
+		if (n) build(a, 1, 0, n);
+	}
+	// all on [l, r)
+	void chmin(int l, int r, ll v) { chmin(1, 0, n, l, r, v); } // a[i] = min(a[i], v)
+	void chmax(int l, int r, ll v) { chmax(1, 0, n, l, r, v); } // a[i] = max(a[i], v)
+	void add(int l, int r, ll v) { add(1, 0, n, l, r, v); }
+	ll query(int l, int r) { return query(1, 0, n, l, r); }
+};
@@ -0,0 +1,44 @@
+#include <vector>
+using namespace std;
+
+// Queue that returns the fold of its elements, for any monoid M (as in
+// MonoidTree), e.g. gcd, matrix or affine products.
+// Two-stack queue in a ring buffer, amortized O(1) per operation:
+// [l, mid) keeps suffix folds in agg, [mid, r) is folded into back.
+template<class M>
+struct SlidingWindow {
+	using T = typename M::T;
+	vector<T> val, agg;
+	size_t l = 0, mid = 0, r = 0, mask;
+	T back = M::I;
+
+	void grow() {
+		size_t cap = val.size() * 2;
+		vector<T> nv(cap), na(cap);
+		for (size_t i = l; i < r; ++i) nv[i - l] = val[i & mask], na[i - l] = agg[i & mask];
+		val.swap(nv), agg.swap(na);
+		mid -= l, r -= l, l = 0, mask = cap - 1;
+	}
+
+	SlidingWindow(int cap = 16) {
+		size_t c = 1;
+		while (c < size_t(cap)) c *= 2;
+		val.resize(c), agg.resize(c), mask = c - 1;
+	}
+	void push(T x) {
+		if (r - l == val.size()) grow();
+		val[r++ & mask] = x;
+		back = M::f(back, x);
+	}
+	void pop() {
+		if (l == mid) {
+			T s = M::I;
+			for (size_t i = r; i-- > l;) agg[i & mask] = s = M::f(val[i & mask], s);
+			mid = r, back = M::I;
+		}
+		++l;
+	}
+	T get() { return M::f(l < mid ? agg[l & mask] : M::I, back); }
+	int size() { return int(r - l); }
+	bool empty() { return r == l; }
+};
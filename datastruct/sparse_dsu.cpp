@@ -0,0 +1,71 @@
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// DSU over arbitrary 64-bit keys. Keys get compact slot ids on first
+// use from an open addressing table, so memory is O(keys touched).
+struct SparseDSU {
+	std::vector<uint64_t> keys;
+	std::vector<int> slot; // -1 if empty
+	std::vector<int> f, siz;
+
+	static uint64_t mix(uint64_t x) { // splitmix64
+		x += 0x9e3779b97f4a7c15ULL;
+		x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+		return x ^ (x >> 31);
+	}
+	void grow() {
+		std::vector<uint64_t> ok = keys;
+		std::vector<int> os = slot;
+		keys.assign(ok.size() * 2, 0);
+		slot.assign(os.size() * 2, -1);
+		for (int i = 0; i < int(os.size()); ++i) {
+			if (os[i] < 0) continue;
+			std::size_t h = mix(ok[i]) & (slot.size() - 1);
+			while (slot[h] >= 0) h = (h + 1) & (slot.size() - 1);
+			keys[h] = ok[i];
+			slot[h] = os[i];
+		}
+	}
+
+	SparseDSU(int expected = 0) {
+		int cap = 16;
+		while (cap < expected * 2) cap *= 2;
+		keys.assign(cap, 0);
+		slot.assign(cap, -1);
+		f.reserve(expected);
+		siz.reserve(expected);
+	}
+	// slot id of key, created on first use
+	int id(uint64_t x) {
+		std::size_t h = mix(x) & (slot.size() - 1);
+		while (slot[h] >= 0) {
+			if (keys[h] == x) return slot[h];
+			h = (h + 1) & (slot.size() - 1);
+		}
+		int k = int(f.size());
+		keys[h] = x;
+		slot[h] = k;
+		f.push_back(k);
+		siz.push_back(1);
+		if (f.size() * 2 > slot.size()) grow();
+		return k;
+	}
+	int root(int x) { // x is a slot id
+		while (x != f[x]) x = f[x] = f[f[x]];
+		return x;
+	}
+	bool same(uint64_t x, uint64_t y) { return root(id(x)) == root(id(y)); }
+	bool merge(uint64_t x, uint64_t y) {
+		int a = root(id(x)), b = root(id(y));
+		if (a == b) return false;
+		if (siz[a] < siz[b]) std::swap(a, b);
+		siz[a] += siz[b];
+		f[b] = a;
+		return true;
+	}
+	int size(uint64_t x) { return siz[root(id(x))]; }
+	int count() { return int(f.size()); } // keys touched so far
+};
@@ -1,6 +1,11 @@
+#include <algorithm>
+#include <bit>
 #include <chrono>
+#include <future>
 #include <random>
+#include <thread>
 #include <tuple>
+#include <vector>
 using namespace std;
 
 mt19937 rng(chrono::steady_clock::now().time_since_epoch().count());
@@ -67,4 +72,110 @@ struct Treap {
 		a->update();
 		return {a, r};
 	}
+
+	static int size(Treap* a) { return a != nullptr ? a->sz : 0; }
+
+	// O(n) build from keys in sorted order: Cartesian tree on priorities
+	static Treap* build(const vector<int>& keys) {
+		vector<Treap*> st;
+		for (int x : keys) {
+			Treap *t = new Treap(x), *last = nullptr;
+			while (!st.empty() && st.back()->prior > t->prior) {
+				last = st.back();
+				st.pop_back();
+				last->update();
+			}
+			t->l = last;
+			if (!st.empty()) st.back()->r = t;
+			st.push_back(t);
+		}
+		for (int i = int(st.size()) - 1; i >= 0; --i) st[i]->update();
+		return st.empty() ? nullptr : st[0];
+	}
+
+	// Below: treaps as sets ordered by v.
+	// {keys < k, keys >= k}, or {keys <= k, keys > k} if le
+	static pair<Treap*, Treap*> split_key(Treap* a, int k, bool le = false) {
+		if (a == nullptr) {
+			return {0, 0};
+		}
+		a->push();
+		Treap* r;
+		if (le ? a->v > k : a->v >= k) {
+			tie(r, a->l) = split_key(a->l, k, le);
+			a->update();
+			return {r, a};
+		}
+		tie(a->r, r) = split_key(a->r, k, le);
+		a->update();
+		return {a, r};
+	}
+
+	// Runs f and g, in parallel if there is enough work and we are fewer
+	// than about log2(cores) forks deep, so at most ~2 * cores threads exist
+	static const int PAR = 1 << 14;
+	static int max_depth() {
+		static const int D = bit_width(max(1u, thread::hardware_concurrency()));
+		return D;
+	}
+	template<class F, class G>
+	static void fork(int work, int d, F f, G g) {
+		if (work < PAR || d >= max_depth()) {
+			f(), g();
+			return;
+		}
+		auto h = async(launch::async, f);
+		g();
+		h.get();
+	}
+
+	// Join-based set operations, O(m log(n / m + 1)) work.
+	// They reuse the input nodes; nodes dropped from the result are not freed.
+	// d is the fork depth, used internally.
+	static Treap* unite(Treap* a, Treap* b, int d = 0) {
+		if ((a == nullptr) || (b == nullptr)) {
+			return (a != nullptr ? a : b);
+		}
+		if (a->prior > b->prior) swap(a, b);
+		a->push();
+		int work = a->sz + b->sz;
+		auto [bl, bge] = split_key(b, a->v);
+		auto br = split_key(bge, a->v, true).second;
+		Treap *l, *r;
+		fork(work, d, [&] { l = unite(a->l, bl, d + 1); }, [&] { r = unite(a->r, br, d + 1); });
+		a->l = l, a->r = r;
+		a->update();
+		return a;
+	}
+	static Treap* intersect(Treap* a, Treap* b, int d = 0) {
+		if ((a == nullptr) || (b == nullptr)) {
+			return nullptr;
+		}
+		if (a->prior > b->prior) swap(a, b);
+		a->push();
+		int work = a->sz + b->sz;
+		auto [bl, bge] = split_key(b, a->v);
+		auto [eq, br] = split_key(bge, a->v, true);
+		Treap *l, *r;
+		fork(work, d, [&] { l = intersect(a->l, bl, d + 1); }, [&] { r = intersect(a->r, br, d + 1); });
+		if (eq == nullptr) return merge(l, r);
+		a->l = l, a->r = r;
+		a->update();
+		return a;
+	}
+	static Treap* difference(Treap* a, Treap* b, int d = 0) { // a \ b
+		if ((a == nullptr) || (b == nullptr)) {
+			return a;
+		}
+		a->push();
+		int work = a->sz + b->sz;
+		auto [bl, bge] = split_key(b, a->v);
+		auto [eq, br] = split_key(bge, a->v, true);
+		Treap *l, *r;
+		fork(work, d, [&] { l = difference(a->l, bl, d + 1); }, [&] { r = difference(a->r, br, d + 1); });
+		if (eq != nullptr) return merge(l, r);
+		a->l = l, a->r = r;
+		a->update();
+		return a;
+	}
 };
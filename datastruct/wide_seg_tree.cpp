@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <vector>
+using namespace std;
+
+// Static B-ary segment tree: every node is one cache line holding B
+// children, so a query or update touches O(log_B n) lines. Monoid as in
+// MonoidTree. Folds inside a node run over all B slots with a
+// mask, giving fixed-length loops the compiler can vectorize.
+template<class M, int B = 64 / sizeof(typename M::T)>
+struct WideTree {
+	using T = typename M::T;
+	struct alignas(64) Node {
+		T a[B];
+	};
+	vector<Node> t;
+	vector<int> off; // level h is nodes [off[h], off[h + 1]), leaves are level 0
+
+	static T fold(const Node& x, int l, int r) { // [l, r) inside one node
+		T ret = M::I;
+		T v[B]; // select first: folding the select directly compiles to branches
+		for (int i = 0; i < B; ++i) v[i] = l <= i && i < r ? x.a[i] : M::I;
+		for (int i = 0; i < B; ++i) ret = M::f(ret, v[i]);
+		return ret;
+	}
+
+	WideTree(int n) {
+		int cnt = max(1, (n + B - 1) / B);
+		off = {0};
+		for (;;) {
+			off.push_back(off.back() + cnt);
+			if (cnt == 1) break;
+			cnt = (cnt + B - 1) / B;
+		}
+		Node e;
+		for (auto& x : e.a) x = M::I;
+		t.assign(off.back(), e);
+	}
+	WideTree(const vector<T>& v) : WideTree(int(v.size())) { // O(n) build
+		for (int i = 0; i < int(v.size()); ++i) t[i / B].a[i % B] = v[i];
+		for (int h = 0; h + 2 < int(off.size()); ++h) {
+			for (int k = 0; k < off[h + 1] - off[h]; ++k) t[off[h + 1] + k / B].a[k % B] = fold(t[off[h] + k], 0, B);
+		}
+	}
+	void change(int k, T x) {
+		t[k / B].a[k % B] = x;
+		for (int h = 0; h + 2 < int(off.size()); ++h) {
+			k /= B;
+			t[off[h + 1] + k / B].a[k % B] = fold(t[off[h] + k], 0, B);
+		}
+	}
+	T query(int l, int r) const { // [l, r)
+		T ra = M::I, rb = M::I;
+		for (int h = 0; l < r; ++h) {
+			int bl = l / B, br = (r - 1) / B;
+			if (bl == br) {
+				ra = M::f(ra, fold(t[off[h] + bl], l % B, (r - 1) % B + 1));
+				break;
+			}
+			ra = M::f(ra, fold(t[off[h] + bl], l % B, B));
+			rb = M::f(fold(t[off[h] + br], 0, (r - 1) % B + 1), rb);
+			l = bl + 1, r = br;
+		}
+		return M::f(ra, rb);
+	}
+};
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <random>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../datastruct/concurrent_dsu.cpp"
+using namespace std;
+
+// Parallel connected components of an edge list, Afforest style:
+// link a sample of the edges, find the largest component c, then link
+// the rest, skipping edges whose endpoints both already point to c.
+// Writes dense ids (numbered by smallest vertex) into label and
+// returns the number of components.
+int connected_components(int n, const vector<pair<int, int>>& edges, span<int> label, int threads = 0) {
+	if (threads <= 0) threads = max(1, int(thread::hardware_concurrency()));
+	int m = int(edges.size());
+	auto parallel = [&](int len, auto f) { // f(l, r) on chunks of [0, len)
+		vector<thread> th;
+		for (int t = 0; t < threads; ++t) {
+			int l = int(1LL * len * t / threads), r = int(1LL * len * (t + 1) / threads);
+			th.emplace_back(f, l, r);
+		}
+		for (auto& t : th) t.join();
+	};
+
+	ConcurrentDSU dsu(n);
+	int s = min(m, n); // sampled prefix of each chunk has this many edges in total
+	parallel(m, [&](int l, int r) {
+		for (int i = l; i < l + int(1LL * s * (r - l) / max(m, 1)); ++i) dsu.merge(edges[i].first, edges[i].second);
+	});
+	parallel(n, [&](int l, int r) {
+		for (int i = l; i < r; ++i) dsu.root(i);
+	});
+
+	int c = 0;
+	if (n > 0) {
+		mt19937 rng(n);
+		vector<int> sample(min(n, 1024));
+		for (auto& x : sample) x = dsu.f[rng() % n];
+		sort(sample.begin(), sample.end());
+		for (int i = 0, best = 0; i < int(sample.size());) {
+			int j = i;
+			while (j < int(sample.size()) && sample[j] == sample[i]) ++j;
+			if (j - i > best) best = j - i, c = sample[i];
+			i = j;
+		}
+	}
+	parallel(m, [&](int l, int r) {
+		for (int i = l + int(1LL * s * (r - l) / max(m, 1)); i < r; ++i) {
+			auto [u, v] = edges[i];
+			if (dsu.f[u] == c && dsu.f[v] == c) continue;
+			dsu.merge(u, v);
+		}
+	});
+
+	parallel(n, [&](int l, int r) {
+		for (int i = l; i < r; ++i) label[i] = dsu.root(i);
+	});
+	int k = 0;
+	for (int i = 0; i < n; ++i) label[i] = label[i] == i ? k++ : label[label[i]];
+	return k;
+}
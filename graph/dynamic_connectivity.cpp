@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <utility>
+#include <vector>
+#include "../datastruct/rollback_dsu.cpp"
+using namespace std;
+
+// Offline dynamic connectivity: edge insertions, deletions and
+// connectivity queries, answered together in O((n + q) log^2 q).
+// Each edge lives on an interval of query indices; the intervals are
+// put on a segment tree over time which is walked with a RollbackDSU.
+struct DynamicConnectivity {
+	int n;
+	vector<pair<int, int>> queries;
+	map<pair<int, int>, vector<int>> open; // edge -> start times
+	vector<pair<pair<int, int>, pair<int, int>>> alive; // {edge, [l, r)}
+	vector<vector<pair<int, int>>> seg;
+	vector<bool> ans;
+
+	void add(int s, int x, int y, int l, int r, pair<int, int> e) {
+		if (r <= x || y <= l) return;
+		if (l <= x && y <= r) return seg[s].push_back(e);
+		int m = (x + y) / 2;
+		add(s * 2, x, m, l, r, e);
+		add(s * 2 + 1, m, y, l, r, e);
+	}
+	void dfs(int s, int x, int y, RollbackDSU& dsu) {
+		int t = dsu.snapshot();
+		for (auto [u, v] : seg[s]) dsu.merge(u, v);
+		if (y - x == 1) {
+			auto [u, v] = queries[x];
+			ans[x] = dsu.same(u, v);
+		} else {
+			int m = (x + y) / 2;
+			dfs(s * 2, x, m, dsu);
+			dfs(s * 2 + 1, m, y, dsu);
+		}
+		dsu.rollback(t);
+	}
+
+	DynamicConnectivity(int n) : n(n) {}
+
+	void addedge(int u, int v) {
+		if (u > v) swap(u, v);
+		open[{u, v}].push_back(int(queries.size()));
+	}
+	// removes one copy of a previously added edge
+	void removeedge(int u, int v) {
+		if (u > v) swap(u, v);
+		auto& st = open[{u, v}];
+		assert(!st.empty());
+		alive.push_back({{u, v}, {st.back(), int(queries.size())}});
+		st.pop_back();
+	}
+	void query(int u, int v) { queries.push_back({u, v}); }
+
+	// Answers for all query() calls so far, in order. Edges still open
+	// last until the final query; the log is kept, so run() can be repeated.
+	vector<bool> run() {
+		int q = int(queries.size());
+		ans.assign(q, false);
+		if (q == 0) return ans;
+		seg.assign(4 * q, {});
+		for (auto& [e, st] : open) {
+			for (int l : st) add(1, 0, q, l, q, e);
+		}
+		for (auto& [e, lr] : alive) add(1, 0, q, lr.first, lr.second, e);
+		RollbackDSU dsu(n);
+		dfs(1, 0, q, dsu);
+		return ans;
+	}
+};
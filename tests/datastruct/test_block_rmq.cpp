@@ -0,0 +1,74 @@
+#include "../../datastruct/block_rmq.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int naive_argmin(const vector<int>& v, int l, int r) {
+	int ret = l;
+	for (int i = l + 1; i <= r; i++) {
+		if (v[i] < v[ret]) ret = i;
+	}
+	return ret;
+}
+
+int main() {
+	// Test 1: Basic queries
+	{
+		vector<int> v = {3, 1, 4, 1, 5, 9, 2, 6};
+		BlockRMQ<int> rmq(v);
+		assert(rmq.getmin(0, 7) == 1);
+		assert(rmq.argmin(0, 7) == 1);  // Leftmost minimum
+		assert(rmq.argmin(2, 7) == 3);
+		assert(rmq.getmin(4, 7) == 2);
+		assert(rmq.getmin(5, 5) == 9);
+	}
+
+	// Test 2: Single element
+	{
+		BlockRMQ<int> rmq(vector<int>{42});
+		assert(rmq.getmin(0, 0) == 42);
+	}
+
+	// Test 3: Max with a comparator and small blocks
+	{
+		vector<int> v = {3, 8, 8, 2, 7, 1, 8, 0, 5};
+		BlockRMQ<int, greater<int>, 2> rmq(v);
+		assert(rmq.getmin(0, 8) == 8);
+		assert(rmq.argmin(0, 8) == 1);
+		assert(rmq.argmin(3, 8) == 6);
+		assert(rmq.getmin(7, 8) == 5);
+	}
+
+	// Test 4: Fuzzy testing across block boundaries
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			int n = 1 + rng() % 300;
+			vector<int> v(n);
+			for (auto& x : v) x = rng() % 50;
+			BlockRMQ<int> rmq(v);
+			BlockRMQ<int, less<int>, 4> small(v);
+			for (int q = 0; q < 100; q++) {
+				int l = rng() % n, r = l + rng() % (n - l);
+				int expect = naive_argmin(v, l, r);
+				assert(rmq.argmin(l, r) == expect);
+				assert(small.argmin(l, r) == expect);
+			}
+		}
+	}
+
+	// Test 5: Table memory is small compared to n log n
+	{
+		vector<long long> v(1 << 16);
+		for (int i = 0; i < (1 << 16); i++) v[i] = (1LL * i * 7919) % 65521;
+		BlockRMQ<long long> rmq(v);
+		assert(rmq.spr.size() <= (v.size() / 32) * 12);
+		assert(rmq.getmin(0, (1 << 16) - 1) == 0);
+	}
+
+	cout << "All block RMQ tests passed!" << endl;
+	return 0;
+}
@@ -0,0 +1,130 @@
+#include "../../datastruct/btree_set.cpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Checks every query of s against the sorted vector ref
+template<class T, int B>
+void check(const BTreeSet<T, B>& s, const vector<T>& ref) {
+	assert(s.size() == (int)ref.size());
+	for (int k = 0; k < (int)ref.size(); ++k) assert(s.find_by_order(k) == ref[k]);
+}
+
+int main() {
+	// Test 1: Basic multiset operations
+	{
+		BTreeSet<int> s;
+		assert(s.empty());
+		for (int x : {5, 1, 3, 3, 9}) s.insert(x);
+		assert(s.size() == 5);
+		assert(s.find_by_order(0) == 1);
+		assert(s.find_by_order(1) == 3 && s.find_by_order(2) == 3);
+		assert(s.order_of_key(3) == 1);
+		assert(s.order_of_key(3, true) == 3);
+		assert(s.order_of_key(100) == 5);
+		assert(s.count(3) == 2 && s.count(4) == 0);
+		assert(s.erase(3));
+		assert(s.count(3) == 1);
+		assert(!s.erase(4));
+		assert(s.size() == 4);
+	}
+
+	// Test 2: Empty tree
+	{
+		BTreeSet<int> s;
+		assert(s.order_of_key(0) == 0);
+		assert(!s.erase(0));
+		BTreeSet<int> b(vector<int>{});
+		assert(b.empty() && b.count(1) == 0);
+		b.insert(1);
+		assert(b.find_by_order(0) == 1);
+	}
+
+	// Test 3: Ascending and descending inserts with a small fanout
+	{
+		BTreeSet<int, 4> a, d;
+		vector<int> ref;
+		for (int i = 0; i < 1000; ++i) {
+			a.insert(i);
+			d.insert(999 - i);
+			ref.push_back(i);
+		}
+		check(a, ref);
+		check(d, ref);
+		for (int i = 0; i < 1000; ++i) {
+			assert(a.order_of_key(i) == i);
+			assert(d.order_of_key(i, true) == i + 1);
+		}
+	}
+
+	// Test 4: Erase everything, then reuse
+	{
+		BTreeSet<int, 4> s;
+		for (int i = 0; i < 500; ++i) s.insert(i % 50);
+		for (int i = 0; i < 500; ++i) assert(s.erase(i % 50));
+		assert(s.empty() && !s.erase(0));
+		for (int i = 0; i < 100; ++i) s.insert(-i);
+		assert(s.find_by_order(0) == -99 && s.find_by_order(99) == 0);
+	}
+
+	// Test 5: Bulk load
+	{
+		vector<int> a(100000);
+		for (int i = 0; i < (int)a.size(); ++i) a[i] = i / 3;
+		BTreeSet<int> s(a);
+		check(s, a);
+		assert(s.count(7) == 3);
+		assert(s.order_of_key(1000) == 3000);
+		s.insert(-1);
+		assert(s.find_by_order(0) == -1 && s.size() == 100001);
+	}
+
+	// Test 6: Strings
+	{
+		BTreeSet<string, 8> s;
+		for (string x : {"pear", "apple", "fig", "apple", "kiwi"}) s.insert(x);
+		assert(s.find_by_order(0) == "apple" && s.find_by_order(4) == "pear");
+		assert(s.count("apple") == 2);
+		assert(s.order_of_key("g") == 3);
+	}
+
+	// Test 7: Fuzz against a sorted vector
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 40; ++test) {
+			int range = 1 + rng() % 200;
+			vector<int> ref;
+			for (int i = 0; i < (int)(rng() % 100); ++i) ref.push_back(rng() % range);
+			sort(ref.begin(), ref.end());
+			BTreeSet<int, 4> s(ref);
+			for (int op = 0; op < 2000; ++op) {
+				int x = rng() % range;
+				int type = rng() % 4;
+				if (type == 0) {
+					s.insert(x);
+					ref.insert(upper_bound(ref.begin(), ref.end(), x), x);
+				} else if (type == 1) {
+					auto it = lower_bound(ref.begin(), ref.end(), x);
+					bool has = it != ref.end() && *it == x;
+					if (has) ref.erase(it);
+					assert(s.erase(x) == has);
+				} else if (type == 2) {
+					assert(s.order_of_key(x) == lower_bound(ref.begin(), ref.end(), x) - ref.begin());
+					assert(s.count(x) == (int)count(ref.begin(), ref.end(), x));
+				} else if (!ref.empty()) {
+					int k = rng() % ref.size();
+					assert(s.find_by_order(k) == ref[k]);
+				}
+			}
+			check(s, ref);
+		}
+	}
+
+	cout << "All B-tree set tests passed!" << endl;
+	return 0;
+}
@@ -0,0 +1,98 @@
+#include "../../datastruct/cht.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: Basic hull
+	{
+		MonotoneCHT<ll> cht;
+		cht.add_line(Line<ll>(2, 0));
+		cht.add_line(Line<ll>(0, 4));
+		cht.add_line(Line<ll>(-1, 10));
+		assert(cht.get_best(0) == 0);
+		assert(cht.get_best(2) == 4);
+		assert(cht.get_best(5) == 4);
+		assert(cht.get_best(6) == 4);
+		assert(cht.get_best(10) == 0);
+		assert(cht.get_best_monotone(-3) == -6);
+		assert(cht.get_best_monotone(3) == 4);
+		assert(cht.get_best_monotone(10) == 0);
+	}
+
+	// Test 2: Equal slopes keep the lower line, useless middle lines are dropped
+	{
+		MonotoneCHT<ll> cht;
+		cht.add_line(Line<ll>(1, 5));
+		cht.add_line(Line<ll>(1, 3));
+		cht.add_line(Line<ll>(1, 7));
+		assert(cht.h.size() == 1);
+		assert(cht.get_best(0) == 3);
+		cht.add_line(Line<ll>(0, 100));
+		cht.add_line(Line<ll>(-1, 3));
+		assert(cht.h.size() == 2);
+	}
+
+	// Test 3: Large coordinates need the 128-bit comparisons
+	{
+		const ll C = 1000000000;
+		MonotoneCHT<ll> cht;
+		cht.add_line(Line<ll>(C, -C * C));
+		cht.add_line(Line<ll>(0, 0));
+		cht.add_line(Line<ll>(-C, -C * C + 1));
+		assert(cht.get_best(0) == -C * C);
+		assert(cht.get_best(-C) == -2 * C * C);
+		assert(cht.get_best(C) == -2 * C * C + 1);
+	}
+
+	// Test 4: Fuzzy testing both query modes against brute force
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 200; test++) {
+			int n = 1 + rng() % 20;
+			vector<ll> slopes(n);
+			for (auto& a : slopes) a = ll(rng() % 21) - 10;
+			sort(slopes.rbegin(), slopes.rend());
+			MonotoneCHT<ll> cht;
+			vector<Line<ll>> lines;
+			ll x = -50;
+			for (int i = 0; i < n; i++) {
+				lines.push_back(Line<ll>(slopes[i], ll(rng() % 201) - 100));
+				cht.add_line(lines.back());
+				for (int q = 0; q < 3; q++) {
+					ll y = ll(rng() % 101) - 50;
+					ll expect = LLONG_MAX;
+					for (auto& f : lines) expect = min(expect, f(y));
+					assert(cht.get_best(y) == expect);
+
+					x += rng() % 5;
+					expect = LLONG_MAX;
+					for (auto& f : lines) expect = min(expect, f(x));
+					assert(cht.get_best_monotone(x) == expect);
+				}
+			}
+		}
+	}
+
+	// Test 5: Intercept differences that overflow long long
+	{
+		const ll B = 5000000000000000000LL;
+		using C = MonotoneCHT<ll>;
+		// a and c meet at x = B, exactly where a and b meet
+		assert(C::bad(Line<ll>(1, -B), Line<ll>(0, 0), Line<ll>(-1, B)));
+		// a and b meet at x = B - 1, before a and c
+		assert(!C::bad(Line<ll>(1, -B), Line<ll>(0, -1), Line<ll>(-1, B)));
+		C cht;
+		cht.add_line(Line<ll>(1, -B));
+		cht.add_line(Line<ll>(0, -1));
+		cht.add_line(Line<ll>(-1, B));
+		assert(cht.h.size() == 3);
+		assert(cht.get_best(0) == -B && cht.get_best(B) == -1);
+	}
+
+	cout << "All convex hull trick tests passed!" << endl;
+	return 0;
+}
@@ -0,0 +1,92 @@
+#include "../../datastruct/concurrent_dsu.cpp"
+#include "../../datastruct/dsu.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: Basic operations
+	{
+		ConcurrentDSU dsu(5);
+		assert(!dsu.same(0, 1));
+		assert(dsu.merge(0, 1));
+		assert(dsu.same(0, 1));
+		assert(!dsu.same(0, 2));
+		assert(!dsu.merge(1, 0));  // Already connected
+	}
+
+	// Test 2: Single element
+	{
+		ConcurrentDSU dsu(1);
+		assert(dsu.root(0) == 0);
+		assert(dsu.same(0, 0));
+		assert(!dsu.merge(0, 0));
+	}
+
+	// Test 3: Root is the smallest index of the component
+	{
+		ConcurrentDSU dsu(10);
+		dsu.merge(7, 9);
+		dsu.merge(9, 3);
+		dsu.merge(5, 7);
+		for (int x : {3, 5, 7, 9}) assert(dsu.root(x) == 3);
+		assert(dsu.root(4) == 4);
+	}
+
+	// Test 4: Long chain, merged from the far end
+	{
+		ConcurrentDSU dsu(1000);
+		for (int i = 999; i > 0; --i) dsu.merge(i, i - 1);
+		for (int i = 0; i < 1000; ++i) assert(dsu.root(i) == 0);
+	}
+
+	// Test 5: Fuzzy single-threaded against DSU
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			int n = 1 + rng() % 30;
+			DSU a(n);
+			ConcurrentDSU b(n);
+			for (int op = 0; op < 50; ++op) {
+				int x = rng() % n, y = rng() % n;
+				if (rng() % 2) assert(a.merge(x, y) == b.merge(x, y));
+				else assert(a.same(x, y) == b.same(x, y));
+			}
+		}
+	}
+
+	// Test 6: Many threads merging into one structure
+	{
+		const int n = 20000, m = 30000, k = 4;
+		mt19937 rng(42);
+		vector<pair<int, int>> edges(m);
+		for (auto& [x, y] : edges) x = rng() % n, y = rng() % n;
+
+		ConcurrentDSU b(n);
+		vector<int> merged(k);
+		vector<thread> th;
+		for (int t = 0; t < k; ++t) {
+			th.emplace_back([&, t] {
+				for (int i = t; i < m; i += k) merged[t] += b.merge(edges[i].first, edges[i].second);
+			});
+		}
+		for (auto& t : th) t.join();
+
+		DSU a(n);
+		int expect = 0;
+		for (auto [x, y] : edges) expect += a.merge(x, y);
+		assert(merged[0] + merged[1] + merged[2] + merged[3] == expect);
+		for (int i = 0; i < n; ++i) assert(a.same(i, b.root(i)));
+		for (int q = 0; q < 1000; ++q) {
+			int x = rng() % n, y = rng() % n;
+			assert(a.same(x, y) == b.same(x, y));
+		}
+	}
+
+	std::cout << "All concurrent DSU tests passed!" << std::endl;
+	return 0;
+}
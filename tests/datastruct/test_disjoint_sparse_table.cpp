@@ -0,0 +1,82 @@
+#include "../../datastruct/disjoint_sparse_table.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using ll = long long;
+
+const ll P = 1000000007;
+
+struct Prod {
+	using T = ll;
+	static T f(T a, T b) { return a * b % P; }
+};
+
+// 2x2 matrix product mod P, not commutative
+struct Mat {
+	using T = vector<ll>;
+	static T f(const T& a, const T& b) {
+		return {(a[0] * b[0] + a[1] * b[2]) % P, (a[0] * b[1] + a[1] * b[3]) % P,
+		        (a[2] * b[0] + a[3] * b[2]) % P, (a[2] * b[1] + a[3] * b[3]) % P};
+	}
+};
+
+// Counts combines to check that every query does exactly one
+int calls = 0;
+struct Count {
+	using T = int;
+	static T f(T a, T b) { return ++calls, a + b; }
+};
+
+int main() {
+	// Test 1: Range products
+	{
+		DisjointSparseTable<Prod> dst({2, 3, 5, 7, 11});
+		assert(dst.query(0, 4) == 2310);
+		assert(dst.query(1, 3) == 105);
+		assert(dst.query(2, 2) == 5);
+		assert(dst.query(3, 4) == 77);
+	}
+
+	// Test 2: Single element
+	{
+		DisjointSparseTable<Prod> dst({9});
+		assert(dst.query(0, 0) == 9);
+		assert(dst.t.empty());
+	}
+
+	// Test 3: Exactly one combine per query
+	{
+		int n = 37;
+		DisjointSparseTable<Count> dst(vector<int>(n, 1));
+		for (int l = 0; l < n; l++) {
+			for (int r = l; r < n; r++) {
+				calls = 0;
+				assert(dst.query(l, r) == r - l + 1);
+				assert(calls == (l < r));
+			}
+		}
+	}
+
+	// Test 4: Fuzzy testing a non-commutative op against brute force
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			int n = 1 + rng() % 40;
+			vector<vector<ll>> v(n);
+			for (auto& m : v) m = {ll(rng() % 10), ll(rng() % 10), ll(rng() % 10), ll(rng() % 10)};
+			DisjointSparseTable<Mat> dst(v);
+			for (int q = 0; q < 30; q++) {
+				int l = rng() % n, r = l + rng() % (n - l);
+				auto expect = v[l];
+				for (int i = l + 1; i <= r; i++) expect = Mat::f(expect, v[i]);
+				assert(dst.query(l, r) == expect);
+			}
+		}
+	}
+
+	cout << "All disjoint sparse table tests passed!" << endl;
+	return 0;
+}
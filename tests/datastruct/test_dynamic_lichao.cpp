@@ -0,0 +1,77 @@
+#include "../../datastruct/dynamic_lichao.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: Empty tree returns INF
+	{
+		DynamicLiChao<ll> lc(0, 100);
+		assert(lc.get_best(50) == lc.INF);
+	}
+
+	// Test 2: Full lines
+	{
+		DynamicLiChao<ll> lc(-100, 100);
+		lc.add_line(Line<ll>(1, 0));    // y = x
+		lc.add_line(Line<ll>(-1, 10));  // y = -x + 10
+		assert(lc.get_best(0) == 0);
+		assert(lc.get_best(5) == 5);
+		assert(lc.get_best(10) == 0);
+		assert(lc.get_best(-100) == -100);
+		assert(lc.get_best(100) == -90);
+	}
+
+	// Test 3: Segments
+	{
+		DynamicLiChao<ll> lc(0, 20);
+		lc.add_segment(Line<ll>(0, 5), 3, 7);
+		lc.add_segment(Line<ll>(1, -10), 10, 20);
+		assert(lc.get_best(2) == lc.INF);
+		assert(lc.get_best(3) == 5);
+		assert(lc.get_best(7) == 5);
+		assert(lc.get_best(8) == lc.INF);
+		assert(lc.get_best(12) == 2);
+		lc.add_line(Line<ll>(0, 3));
+		assert(lc.get_best(5) == 3);
+		assert(lc.get_best(11) == 1);
+	}
+
+	// Test 4: Huge coordinate range, memory follows insertions
+	{
+		const ll C = 1000000000;
+		DynamicLiChao<ll> lc(-C, C);
+		lc.add_line(Line<ll>(C, 0));
+		lc.add_segment(Line<ll>(-C, 0), 0, C);
+		assert(lc.get_best(C) == -C * C);
+		assert(lc.get_best(-C) == -C * C);
+		assert(lc.get_best(0) == 0);
+		assert(lc.p.size() < 2 + 2 * 32 * 31);
+	}
+
+	// Test 5: Fuzzy testing against brute force
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			int lo = int(rng() % 21) - 10, hi = lo + int(rng() % 30);
+			DynamicLiChao<ll> lc(lo, hi);
+			vector<ll> best(hi - lo + 1, lc.INF);
+			for (int op = 0; op < 40; op++) {
+				Line<ll> f(ll(rng() % 21) - 10, ll(rng() % 201) - 100);
+				int l = lo + rng() % (hi - lo + 1), r = lo + rng() % (hi - lo + 1);
+				if (l > r) swap(l, r);
+				if (rng() % 2) l = lo, r = hi;
+				if (l == lo && r == hi && rng() % 2) lc.add_line(f);
+				else lc.add_segment(f, l, r);
+				for (int x = l; x <= r; x++) best[x - lo] = min(best[x - lo], f(x));
+				for (int x = lo; x <= hi; x++) assert(lc.get_best(x) == best[x - lo]);
+			}
+		}
+	}
+
+	cout << "All dynamic Li Chao tests passed!" << endl;
+	return 0;
+}
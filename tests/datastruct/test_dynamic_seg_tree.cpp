@@ -0,0 +1,91 @@
+#include "../../datastruct/dynamic_seg_tree.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	const ll C = 1000000000000000000LL;
+
+	// Test 1: Basic range add and query
+	{
+		DynamicSegTree<> tree(0, 10);
+		tree.change(0, 3, 5);
+		assert(tree.query(0, 3) == 15);
+		assert(tree.query(3, 8) == 0);
+		tree.change(2, 6, 1);
+		assert(tree.query(0, 10) == 19);
+		assert(tree.query(2, 3) == 6);
+		assert(tree.query(5, 5) == 0);  // Empty range
+	}
+
+	// Test 2: Huge coordinates, memory follows the operations
+	{
+		DynamicSegTree<> tree(0, C);
+		tree.change(C - 10, C, 2);
+		tree.change(0, 5, 3);
+		tree.change(C / 2, C / 2 + 1, 7);
+		assert(tree.query(0, C) == 20 + 15 + 7);
+		assert(tree.query(C - 5, C) == 10);
+		assert(tree.query(1, C / 2) == 12);
+		assert(tree.p.size() < 3 * 2 * 64 + 2);
+	}
+
+	// Test 3: Full-range sums need a wide type
+	{
+		DynamicSegTree<__int128> tree(0, C);
+		tree.change(0, C, 1000);
+		assert(tree.query(0, C) == (__int128)C * 1000);
+		assert(tree.p.size() == 2);  // Whole range lands on the root
+	}
+
+	// Test 4: Negative coordinates
+	{
+		DynamicSegTree<> tree(-1000, 1000);
+		tree.change(-1000, 0, 1);
+		tree.change(-10, 10, 2);
+		assert(tree.query(-1000, 1000) == 1000 + 40);
+		assert(tree.query(-5, 5) == 5 + 20);
+	}
+
+	// Test 5: Reset reuses the pool
+	{
+		DynamicSegTree<> tree(0, C, 1000);
+		tree.change(3, 7, 1);
+		auto cap = tree.p.capacity();
+		tree.reset();
+		assert(tree.query(0, C) == 0);
+		assert(tree.p.size() == 2);
+		assert(tree.p.capacity() == cap);
+		tree.change(1, 2, 4);
+		assert(tree.query(0, 10) == 4);
+	}
+
+	// Test 6: Fuzzy testing against brute force
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			int n = 1 + rng() % 40;
+			vector<ll> arr(n);
+			DynamicSegTree<> tree(0, n);
+			for (int op = 0; op < 50; ++op) {
+				int l = rng() % (n + 1), r = rng() % (n + 1);
+				if (l > r) swap(l, r);
+				if (rng() % 2) {
+					ll k = ll(rng() % 21) - 10;
+					for (int i = l; i < r; ++i) arr[i] += k;
+					tree.change(l, r, k);
+				} else {
+					ll expect = 0;
+					for (int i = l; i < r; ++i) expect += arr[i];
+					assert(tree.query(l, r) == expect);
+				}
+			}
+		}
+	}
+
+	cout << "All dynamic segment tree tests passed!" << endl;
+	return 0;
+}
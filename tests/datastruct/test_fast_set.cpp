@@ -0,0 +1,86 @@
+#include "../../datastruct/fast_set.cpp"
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: Basic operations
+	{
+		FastSet s(100);
+		assert(s.size() == 0);
+		assert(s.next(0) == -1 && s.prev(99) == -1);
+		assert(s.insert(10) && s.insert(70) && s.insert(3));
+		assert(!s.insert(10));
+		assert(s.contains(70) && !s.contains(71));
+		assert(s.next(0) == 3 && s.next(4) == 10 && s.next(11) == 70 && s.next(71) == -1);
+		assert(s.prev(99) == 70 && s.prev(69) == 10 && s.prev(10) == 10 && s.prev(2) == -1);
+		assert(s.rank(0) == 0 && s.rank(10) == 1 && s.rank(11) == 2 && s.rank(100) == 3);
+		assert(s.kth(0) == 3 && s.kth(2) == 70 && s.kth(3) == -1);
+		assert(s.erase(10) && !s.erase(10));
+		assert(s.next(4) == 70 && s.size() == 2);
+	}
+
+	// Test 2: Tiny universes and out-of-range queries
+	{
+		FastSet s(1);
+		assert(s.next(-5) == -1);
+		s.insert(0);
+		assert(s.next(-5) == 0 && s.prev(5) == 0 && s.next(1) == -1 && s.prev(-1) == -1);
+		assert(s.rank(0) == 0 && s.rank(1) == 1 && s.kth(0) == 0);
+
+		FastSet e(0);
+		assert(e.next(0) == -1 && e.prev(0) == -1 && e.rank(0) == 0 && e.kth(0) == -1);
+	}
+
+	// Test 3: Word and level boundaries over three levels
+	{
+		int n = 64 * 64 * 3 + 5;
+		FastSet s(n);
+		assert(s.lg == 3);
+		for (int x : {0, 63, 64, 4095, 4096, n - 1}) s.insert(x);
+		assert(s.next(1) == 63 && s.next(65) == 4095 && s.next(4097) == n - 1);
+		assert(s.prev(n - 2) == 4096 && s.prev(4094) == 64 && s.prev(62) == 0);
+		assert(s.rank(4096) == 4 && s.kth(5) == n - 1);
+		s.erase(4095);
+		s.erase(4096);
+		assert(s.next(65) == n - 1 && s.prev(n - 2) == 64);
+	}
+
+	// Test 4: Fuzz against std::set
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 30; ++test) {
+			int n = 1 + rng() % (test < 20 ? 300 : 300000);
+			FastSet s(n);
+			set<int> ref;
+			for (int op = 0; op < 3000; ++op) {
+				int x = rng() % n, type = rng() % 6;
+				if (type == 0) {
+					assert(s.insert(x) == ref.insert(x).second);
+				} else if (type == 1) {
+					assert(s.erase(x) == (ref.erase(x) > 0));
+				} else if (type == 2) {
+					auto it = ref.lower_bound(x);
+					assert(s.next(x) == (it == ref.end() ? -1 : *it));
+				} else if (type == 3) {
+					auto it = ref.upper_bound(x);
+					assert(s.prev(x) == (it == ref.begin() ? -1 : *prev(it)));
+				} else if (type == 4) {
+					assert(s.rank(x) == (int)distance(ref.begin(), ref.lower_bound(x)));
+				} else if (!ref.empty()) {
+					int k = rng() % ref.size();
+					assert(s.kth(k) == *next(ref.begin(), k));
+				}
+			}
+			assert(s.size() == (int)ref.size());
+		}
+	}
+
+	cout << "All fast set tests passed!" << endl;
+	return 0;
+}
@@ -1,6 +1,8 @@
 #include "../../datastruct/fen.cpp"
 #include <cassert>
 #include <iostream>
+#include <random>
+#include <vector>
 
 using namespace std;
 
@@ -184,6 +186,98 @@ int main() {
 		assert(fen.lower_bound(51) == 10);  // Beyond all elements
 	}
 
+	// Test 16: O(n) build matches repeated updates
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			int n = 1 + rng() % 40;
+			vector<int> a(n);
+			for (auto& x : a) x = int(rng() % 21) - 10;
+			FenTree<int> built(a), fen(n);
+			for (int i = 0; i < n; ++i) fen.update(i, a[i]);
+			assert(built.tree == fen.tree);
+		}
+	}
+
+	// Test 17: Range add, range sum
+	{
+		RangeFenTree<long long> fen(10);
+		fen.update(2, 5, 3);   // a[2..4] += 3
+		fen.update(0, 10, 1);  // everything += 1
+		fen.update(4, 10, -2);
+
+		assert(fen.query(0) == 0);
+		assert(fen.query(2) == 2);
+		assert(fen.query(5) == 5 + 9 - 2);
+		assert(fen.query(4, 5) == 2);
+		assert(fen.query(0, 10) == 10 + 9 - 12);
+	}
+
+	// Test 18: Range Fenwick lower bound
+	{
+		RangeFenTree<int> fen(vector<int>{5, 3, 7, 2});
+		fen.update(1, 3, 1);  // 5, 4, 8, 2
+
+		assert(fen.lower_bound(0) == -1);
+		assert(fen.lower_bound(5) == 0);
+		assert(fen.lower_bound(6) == 1);
+		assert(fen.lower_bound(10) == 2);
+		assert(fen.lower_bound(19) == 3);
+		assert(fen.lower_bound(20) == 4);
+	}
+
+	// Test 19: Fuzzy testing range Fenwick against brute force
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			int n = 1 + rng() % 30;
+			vector<long long> a(n);
+			for (auto& x : a) x = rng() % 10;
+			RangeFenTree<long long> fen(a);
+			for (int op = 0; op < 50; ++op) {
+				int l = rng() % (n + 1), r = rng() % (n + 1);
+				if (l > r) swap(l, r);
+				if (rng() % 2) {
+					long long d = rng() % 10;
+					for (int i = l; i < r; ++i) a[i] += d;
+					fen.update(l, r, d);
+				} else {
+					long long sum = 0;
+					for (int i = l; i < r; ++i) sum += a[i];
+					assert(fen.query(l, r) == sum);
+					long long target = rng() % 200;
+					int pos = target <= 0 ? -1 : n;
+					for (long long i = 0, acc = 0; i < n && target > 0; ++i) {
+						acc += a[i];
+						if (acc >= target) {
+							pos = int(i);
+							break;
+						}
+					}
+					assert(fen.lower_bound(target) == pos);
+				}
+			}
+		}
+	}
+
+	// Test 20: Batched queries match scalar queries
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 50; ++test) {
+			int n = 1 + rng() % 100;
+			vector<long long> a(n);
+			for (auto& x : a) x = int(rng() % 21) - 10;
+			FenTree<long long> fen(a);
+			vector<int> idx(rng() % 40);
+			for (auto& i : idx) i = rng() % (n + 1);
+			for (int threads : {1, 3}) {
+				vector<long long> out(idx.size());
+				fen.query_many(idx, out, threads);
+				for (size_t i = 0; i < idx.size(); ++i) assert(out[i] == fen.query(idx[i]));
+			}
+		}
+	}
+
 	cout << "All Fenwick tree tests passed!" << endl;
 	return 0;
 }
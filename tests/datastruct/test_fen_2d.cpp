@@ -0,0 +1,84 @@
+#include "../../datastruct/fen_2d.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: No points
+	{
+		FenTree2D<int, int> fen({});
+		assert(fen.query(10, 10) == 0);
+	}
+
+	// Test 2: Dominance counting
+	{
+		vector<pair<int, int>> pts = {{1, 1}, {2, 5}, {4, 2}, {3, 3}};
+		FenTree2D<int, int> fen(pts);
+		for (auto [x, y] : pts) fen.update(x, y, 1);
+
+		assert(fen.query(5, 5) == 3);   // All but (2, 5)
+		assert(fen.query(5, 6) == 4);
+		assert(fen.query(1, 10) == 0);  // Strict in x
+		assert(fen.query(4, 4) == 2);   // (1, 1), (3, 3)
+		assert(fen.query(2, 2, 5, 4) == 2);  // (4, 2), (3, 3)
+	}
+
+	// Test 3: Duplicate points and coordinates
+	{
+		vector<pair<int, int>> pts = {{2, 2}, {2, 2}, {2, 7}, {5, 2}};
+		FenTree2D<int, long long> fen(pts);
+		fen.update(2, 2, 10);
+		fen.update(2, 2, 5);
+		fen.update(2, 7, 1);
+		fen.update(5, 2, 100);
+
+		assert(fen.query(3, 3) == 15);
+		assert(fen.query(3, 8) == 16);
+		assert(fen.query(6, 3) == 115);
+		assert(fen.query(2, 0, 6, 100) == 116);
+	}
+
+	// Test 4: Large coordinates
+	{
+		vector<pair<long long, long long>> pts = {{-1000000000000LL, 5}, {1000000000000LL, -5}};
+		FenTree2D<long long, int> fen(pts);
+		fen.update(-1000000000000LL, 5, 3);
+		fen.update(1000000000000LL, -5, 4);
+		assert(fen.query(0, 100) == 3);
+		assert(fen.query(2000000000000LL, 0) == 4);
+	}
+
+	// Test 5: Fuzzy testing against brute force
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			int n = 1 + rng() % 30;
+			vector<pair<int, int>> pts(n);
+			for (auto& [x, y] : pts) x = rng() % 10, y = rng() % 10;
+			vector<int> val(n);
+			FenTree2D<int, int> fen(pts);
+			for (int op = 0; op < 50; ++op) {
+				if (rng() % 2) {
+					int i = rng() % n, d = int(rng() % 21) - 10;
+					val[i] += d;
+					fen.update(pts[i].first, pts[i].second, d);
+				} else {
+					int x1 = rng() % 12 - 1, x2 = rng() % 12 - 1, y1 = rng() % 12 - 1, y2 = rng() % 12 - 1;
+					int expect = 0;
+					for (int i = 0; i < n; ++i) {
+						auto [x, y] = pts[i];
+						if (x1 <= x && x < x2 && y1 <= y && y < y2) expect += val[i];
+					}
+					if (x1 > x2 || y1 > y2) continue;
+					assert(fen.query(x1, y1, x2, y2) == expect);
+				}
+			}
+		}
+	}
+
+	cout << "All 2D Fenwick tree tests passed!" << endl;
+	return 0;
+}
@@ -0,0 +1,98 @@
+#include "../../datastruct/hasher61.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace hasher61;
+
+// Reference hash with a plain 128-bit remainder
+hash_t naive(const string& s, int l, int r) {
+	__uint128_t h = 0;
+	for (int i = l; i < r; ++i) h = (h * base + (unsigned char)s[i]) % MOD;
+	return hash_t(h);
+}
+
+int main() {
+	// Test 1: Basic string hashing
+	{
+		assert(calc(string("hello")) == calc(string("hello")));
+		assert(calc(string("hello")) != calc(string("world")));
+		assert(calc(string("")) == 0);
+		assert(calc(string("ab")) != calc(string("ba")));
+	}
+
+	// Test 2: Modular helpers
+	{
+		assert(mad(MOD - 1, MOD - 1, 0) == 1);
+		assert(mad(MOD - 1, 1, 1) == 0);
+		assert(mad(0, 5, MOD - 1) == MOD - 1);
+		assert(sub(0, 1) == MOD - 1 && sub(5, 5) == 0);
+		hash_t a = (1ULL << 60) + 12345, b = (1ULL << 59) + 777;
+		assert(mad(a, b, 3) == hash_t((__uint128_t(a) * b + 3) % MOD));
+	}
+
+	// Test 3: Prefix hashes and ranges match the reference
+	{
+		string s = "abracadabra";
+		auto h = calc_vector(s);
+		assert(h.size() == s.size() + 1 && h[0] == 0);
+		assert(h.back() == calc(s));
+		for (int l = 0; l <= (int)s.size(); ++l) {
+			for (int r = l; r <= (int)s.size(); ++r) assert(range(h, l, r) == naive(s, l, r));
+		}
+		assert(range(h, 0, 4) == range(h, 7, 11)); // "abra"
+		assert(range(h, 0, 4) != range(h, 1, 5));
+		assert(range(h, 3, 3) == 0);
+	}
+
+	// Test 4: Preallocated buffer and vector<int> input
+	{
+		vector<int> v = {5, 1, 5, 1, 5};
+		vector<hash_t> buf(v.size() + 1);
+		calc_prefix(v, buf.data());
+		assert(range(buf.data(), 0, 3) == range(buf.data(), 2, 5));
+		assert(range(buf, 0, 2) == calc(vector<int> {5, 1}));
+	}
+
+	// Test 5: Many strings of different lengths at once
+	{
+		mt19937 rng(42);
+		vector<string> xs(11);
+		for (auto& s : xs) {
+			int n = rng() % 40;
+			for (int i = 0; i < n; ++i) s += char('a' + rng() % 3);
+		}
+		vector<vector<hash_t>> out(xs.size());
+		vector<hash_t*> ptr;
+		for (int j = 0; j < (int)xs.size(); ++j) {
+			out[j].resize(xs[j].size() + 1);
+			ptr.push_back(out[j].data());
+		}
+		calc_prefix_many(xs, ptr);
+		for (int j = 0; j < (int)xs.size(); ++j) assert(out[j] == calc_vector(xs[j]));
+	}
+
+	// Test 6: No collisions among all distinct substrings of a random string
+	{
+		mt19937 rng(42);
+		string s;
+		for (int i = 0; i < 300; ++i) s += char('a' + rng() % 2);
+		auto h = calc_vector(s);
+		set<string> subs;
+		set<hash_t> hs;
+		for (int l = 0; l < (int)s.size(); ++l) {
+			for (int r = l + 1; r <= (int)s.size(); ++r) {
+				subs.insert(s.substr(l, r - l));
+				hs.insert(range(h, l, r));
+			}
+		}
+		assert(subs.size() == hs.size());
+	}
+
+	cout << "All hasher61 tests passed!" << endl;
+	return 0;
+}
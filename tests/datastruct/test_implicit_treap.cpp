@@ -0,0 +1,107 @@
+#include "../../datastruct/implicit_treap.cpp"
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: Insert, erase, to_vector
+	{
+		ImplicitTreap<> t;
+		assert(t.size() == 0);
+		assert(t.to_vector().empty());
+		t.insert(0, 3);
+		t.insert(0, 1);
+		t.insert(1, 2);
+		t.insert(3, 4);
+		assert((t.to_vector() == vector<ll>{1, 2, 3, 4}));
+		t.erase(1);
+		assert((t.to_vector() == vector<ll>{1, 3, 4}));
+		assert(t.size() == 3);
+	}
+
+	// Test 2: Range operations and aggregates
+	{
+		ImplicitTreap<> t;
+		for (int i = 0; i < 6; i++) t.insert(i, i + 1);  // 1 2 3 4 5 6
+		t.reverse(1, 5);                                   // 1 5 4 3 2 6
+		assert((t.to_vector() == vector<ll>{1, 5, 4, 3, 2, 6}));
+		t.add(0, 3, 10);                                   // 11 15 14 3 2 6
+		assert(t.range_sum(0, 6) == 51);
+		assert(t.range_min(0, 3) == 11);
+		t.assign(2, 5, 7);                                 // 11 15 7 7 7 6
+		assert(t.range_min(0, 6) == 6);
+		assert(t.range_sum(1, 4) == 29);
+		t.add(0, 6, -1);                                   // 10 14 6 6 6 5
+		t.reverse(0, 6);                                   // 5 6 6 6 14 10
+		assert((t.to_vector() == vector<ll>{5, 6, 6, 6, 14, 10}));
+	}
+
+	// Test 3: Reset reuses the pool
+	{
+		ImplicitTreap<int> t(100);
+		for (int i = 0; i < 50; i++) t.insert(i, i);
+		auto cap = t.p.capacity();
+		t.reset();
+		assert(t.size() == 0);
+		assert(t.p.size() == 1);
+		t.insert(0, 7);
+		assert(t.range_sum(0, 1) == 7);
+		assert(t.p.capacity() == cap);
+	}
+
+	// Test 4: Long sequence, no recursion anywhere
+	{
+		ImplicitTreap<> t(200000);
+		for (int i = 0; i < 200000; i++) t.insert(i, i % 7);
+		t.reverse(0, 200000);
+		assert(t.range_sum(0, 200000) == 28571 * 21 + 3);
+		assert(t.range_min(5, 6) == (200000 - 6) % 7);
+	}
+
+	// Test 5: Fuzzy testing against a vector
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			ImplicitTreap<> t;
+			vector<ll> v;
+			for (int op = 0; op < 100; op++) {
+				int type = rng() % 7;
+				int n = int(v.size());
+				int l = rng() % (n + 1), r = rng() % (n + 1);
+				if (l > r) swap(l, r);
+				ll x = ll(rng() % 21) - 10;
+				if (type == 0 || n == 0) {
+					t.insert(l, x);
+					v.insert(v.begin() + l, x);
+				} else if (type == 1) {
+					int pos = rng() % n;
+					t.erase(pos);
+					v.erase(v.begin() + pos);
+				} else if (type == 2) {
+					t.reverse(l, r);
+					std::reverse(v.begin() + l, v.begin() + r);
+				} else if (type == 3) {
+					t.add(l, r, x);
+					for (int i = l; i < r; i++) v[i] += x;
+				} else if (type == 4) {
+					t.assign(l, r, x);
+					for (int i = l; i < r; i++) v[i] = x;
+				} else {
+					ll s = 0, m = LLONG_MAX;
+					for (int i = l; i < r; i++) s += v[i], m = min(m, v[i]);
+					assert(t.range_sum(l, r) == s);
+					assert(t.range_min(l, r) == m);
+				}
+				assert(t.to_vector() == v);
+			}
+		}
+	}
+
+	cout << "All implicit treap tests passed!" << endl;
+	return 0;
+}
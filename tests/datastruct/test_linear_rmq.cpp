@@ -6,10 +6,7 @@
 
 using namespace std;
 
-// Include only the structs, not the main function
-#define main main_disabled
 #include "../../datastruct/linear_rmq.cpp"
-#undef main
 
 // Naive RMQ for verification
 int naive_rmq(const vector<int>& v, int l, int r) {
@@ -186,6 +183,48 @@ int main() {
 		assert(v[rmq.query(4, 6)] == -20);
 	}
 
+	// Test 14: Leftmost minimum, fuzzy across block boundaries
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			int n = 1 + rng() % 500;
+			vector<int> v(n);
+			for (int& x : v) x = rng() % 20;
+			RMQ rmq(v);
+			for (int q = 0; q < 100; q++) {
+				int l = rng() % n;
+				int r = l + rng() % (n - l);
+				int expect = l;
+				for (int i = l + 1; i <= r; i++) {
+					if (v[i] < v[expect]) expect = i;
+				}
+				assert(rmq.query(l, r) == expect);
+			}
+		}
+	}
+
+	// Test 15: Large sorted input (used to overflow the recursive DFS)
+	{
+		int n = 1000000;
+		vector<int> v(n);
+		for (int i = 0; i < n; i++) v[i] = i;
+		RMQ rmq(v);
+		assert(rmq.query(0, n - 1) == 0);
+		assert(rmq.query(123456, 987654) == 123456);
+		for (int i = 0; i < n; i++) v[i] = n - i;
+		RMQ rev(v);
+		assert(rev.query(0, n - 1) == n - 1);
+		assert(rev.query(5, 70) == 70);
+	}
+
+	// Test 16: Max with a comparator
+	{
+		vector<long long> v = {3, 9, 2, 9, 4};
+		RMQ<long long, greater<long long>> rmq(v);
+		assert(rmq.query(0, 4) == 1);
+		assert(rmq.query(2, 4) == 3);
+	}
+
 	cout << "All Linear RMQ tests passed!" << endl;
 	return 0;
 }
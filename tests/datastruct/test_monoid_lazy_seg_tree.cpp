@@ -0,0 +1,193 @@
+#include "../../datastruct/monoid_lazy_seg_tree.cpp"
+#include <cassert>
+#include <climits>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using ll = long long;
+
+// Sum with segment length, so actions can scale by length
+struct SumLen {
+	using T = pair<ll, ll>;
+	static constexpr T I = {0, 0};
+	static T f(T a, T b) { return {a.first + b.first, a.second + b.second}; }
+};
+
+struct Add {
+	using F = ll;
+	static constexpr F I = 0;
+	static F f(F a, F b) { return a + b; }
+	static SumLen::T apply(F a, SumLen::T x) { return {x.first + a * x.second, x.second}; }
+};
+
+// x -> first * x + second, mod p
+const ll P = 998244353;
+struct Affine {
+	using F = pair<ll, ll>;
+	static constexpr F I = {1, 0};
+	static F f(F a, F b) { return {a.first * b.first % P, (a.first * b.second + a.second) % P}; }
+	static SumLen::T apply(F a, SumLen::T x) { return {(a.first * (x.first % P) + a.second * x.second) % P, x.second}; }
+};
+
+struct Min {
+	using T = int;
+	static constexpr T I = INT_MAX;
+	static T f(T a, T b) { return min(a, b); }
+};
+
+struct Assign {
+	using F = int;
+	static constexpr F I = INT_MIN; // no assignment
+	static F f(F a, F b) { return a == I ? b : a; }
+	static int apply(F a, int x) { return a == I ? x : a; }
+};
+
+// Polynomial hash {h, B^len, 1 + B + ... + B^(len - 1)} mod p; not commutative
+const ll BASE = 131;
+struct Hash {
+	using T = tuple<ll, ll, ll>;
+	static constexpr T I = {0, 1, 0};
+	static T f(T a, T b) {
+		auto [ha, pa, sa] = a;
+		auto [hb, pb, sb] = b;
+		return {(ha * pb + hb) % P, pa * pb % P, (sa * pb + sb) % P};
+	}
+};
+
+struct HashAdd {
+	using F = ll;
+	static constexpr F I = 0;
+	static F f(F a, F b) { return (a + b) % P; }
+	static Hash::T apply(F a, Hash::T x) {
+		auto [h, pw, sp] = x;
+		return {(h + a * sp) % P, pw, sp};
+	}
+};
+
+vector<pair<ll, ll>> ones(int n) { return vector<pair<ll, ll>>(n, {0, 1}); }
+
+int main() {
+	// Test 1: Range add, range sum
+	{
+		LazyTree<SumLen, Add> tree(ones(10));
+		tree.change(0, 3, 5);
+		assert(tree.query(0, 3).first == 15);
+		assert(tree.query(3, 8).first == 0);
+		tree.change(2, 6, 1);
+		assert(tree.query(0, 10).first == 19);
+		assert(tree.get(2).first == 6);
+		assert(tree.query(4, 4).first == 0);  // Empty range
+	}
+
+	// Test 2: Range assign, range min, point set
+	{
+		LazyTree<Min, Assign> tree(vector<int>{5, 3, 8, 6, 2});
+		assert(tree.query(0, 5) == 2);
+		tree.change(1, 4, 7);  // 5 7 7 7 2
+		assert(tree.query(0, 4) == 5);
+		tree.set(0, 9);        // 9 7 7 7 2
+		assert(tree.query(0, 2) == 7);
+		tree.change(0, 5, 4);
+		assert(tree.query(0, 5) == 4);
+		assert(tree.get(3) == 4);
+	}
+
+	// Test 3: Single element
+	{
+		LazyTree<Min, Assign> tree(1);
+		assert(tree.query(0, 1) == INT_MAX);
+		tree.change(0, 1, 3);
+		assert(tree.query(0, 1) == 3);
+	}
+
+	// Test 4: Fuzzy testing affine updates against brute force
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			int n = 1 + rng() % 40;
+			vector<ll> arr(n);
+			auto init = ones(n);
+			for (int i = 0; i < n; i++) init[i].first = arr[i] = rng() % 100;
+			LazyTree<SumLen, Affine> tree(init);
+			for (int op = 0; op < 50; op++) {
+				int l = rng() % (n + 1), r = rng() % (n + 1);
+				if (l > r) swap(l, r);
+				int type = rng() % 3;
+				if (type == 0) {
+					ll b = rng() % 10, c = rng() % 10;
+					for (int i = l; i < r; i++) arr[i] = (b * arr[i] + c) % P;
+					tree.change(l, r, {b, c});
+				} else if (type == 1 && l < n) {
+					arr[l] = rng() % 100;
+					tree.set(l, {arr[l], 1});
+				} else {
+					ll expect = 0;
+					for (int i = l; i < r; i++) expect = (expect + arr[i]) % P;
+					assert(tree.query(l, r).first % P == expect);
+				}
+			}
+		}
+	}
+
+	// Test 5: Fuzzy testing assign/min against brute force
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			int n = 1 + rng() % 40;
+			vector<int> arr(n);
+			for (auto& x : arr) x = rng() % 100;
+			LazyTree<Min, Assign> tree(arr);
+			for (int op = 0; op < 50; op++) {
+				int l = rng() % (n + 1), r = rng() % (n + 1);
+				if (l > r) swap(l, r);
+				if (rng() % 2) {
+					int x = rng() % 100;
+					for (int i = l; i < r; i++) arr[i] = x;
+					tree.change(l, r, x);
+				} else {
+					int expect = INT_MAX;
+					for (int i = l; i < r; i++) expect = min(expect, arr[i]);
+					assert(tree.query(l, r) == expect);
+				}
+			}
+		}
+	}
+
+	// Test 6: Order-sensitive monoid on sizes that are not powers of two
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 200; test++) {
+			int n = 1 + rng() % 70;
+			vector<ll> arr(n);
+			vector<Hash::T> init(n);
+			for (int i = 0; i < n; i++) arr[i] = rng() % 100, init[i] = {arr[i], BASE, 1};
+			LazyTree<Hash, HashAdd> tree(init);
+			assert(tree.t.size() == size_t(2 * n) && tree.lz.size() == size_t(n));
+			for (int op = 0; op < 60; op++) {
+				int l = rng() % (n + 1), r = rng() % (n + 1);
+				if (l > r) swap(l, r);
+				int type = rng() % 3;
+				if (type == 0) {
+					ll c = rng() % 100;
+					for (int i = l; i < r; i++) arr[i] = (arr[i] + c) % P;
+					tree.change(l, r, c);
+				} else if (type == 1 && l < n) {
+					arr[l] = rng() % 100;
+					tree.set(l, {arr[l], BASE, 1});
+					assert(get<0>(tree.get(l)) == arr[l]);
+				} else {
+					ll expect = 0;
+					for (int i = l; i < r; i++) expect = (expect * BASE + arr[i]) % P;
+					assert(get<0>(tree.query(l, r)) == expect);
+				}
+			}
+		}
+	}
+
+	cout << "All monoid lazy segment tree tests passed!" << endl;
+	return 0;
+}
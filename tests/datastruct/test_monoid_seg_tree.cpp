@@ -0,0 +1,174 @@
+#include "../../datastruct/monoid_seg_tree.cpp"
+#include "../../datastruct/seg_tree.cpp"
+#include <cassert>
+#include <climits>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using ll = long long;
+
+struct Sum {
+	using T = ll;
+	static constexpr T I = 0;
+	static T f(T a, T b) { return a + b; }
+};
+
+struct Min {
+	using T = int;
+	static constexpr T I = INT_MAX;
+	static T f(T a, T b) { return min(a, b); }
+};
+
+// Composition of x -> a * x + b, applied left to right; not commutative
+struct Affine {
+	using T = pair<ll, ll>;
+	static constexpr T I = {1, 0};
+	static T f(T p, T q) { return {p.first * q.first % 998244353, (p.second * q.first + q.second) % 998244353}; }
+};
+
+int main() {
+	// Test 1: Basic sum tree with non power of two size
+	{
+		MonoidTree<Sum> tree(5);
+		for (int i = 0; i < 5; i++) tree.change(i, i + 1);  // 1, 2, 3, 4, 5
+
+		assert(tree.query(0, 5) == 15);
+		assert(tree.query(1, 4) == 9);
+		assert(tree.query(2, 2) == 0);  // Empty range gives identity
+		assert(tree.get(3) == 4);
+	}
+
+	// Test 2: Single element and empty tree
+	{
+		MonoidTree<Min> tree(1);
+		assert(tree.query(0, 1) == INT_MAX);
+		tree.change(0, 7);
+		assert(tree.query(0, 1) == 7);
+
+		MonoidTree<Sum> empty(0);
+		assert(empty.query(0, 0) == 0);
+		assert(empty.max_right(0, [](ll) { return true; }) == 0);
+		assert(empty.min_left(0, [](ll) { return true; }) == 0);
+	}
+
+	// Test 3: max_right and min_left on sums
+	{
+		MonoidTree<Sum> tree(6);
+		vector<int> a = {3, 1, 4, 1, 5, 9};
+		for (int i = 0; i < 6; i++) tree.change(i, a[i]);
+
+		assert(tree.max_right(0, [](ll s) { return s <= 8; }) == 3);   // 3 + 1 + 4
+		assert(tree.max_right(2, [](ll s) { return s < 4; }) == 2);
+		assert(tree.max_right(1, [](ll s) { return s <= 100; }) == 6);
+		assert(tree.min_left(6, [](ll s) { return s <= 14; }) == 4);   // 5 + 9
+		assert(tree.min_left(3, [](ll s) { return s <= 100; }) == 0);
+		assert(tree.min_left(6, [](ll s) { return s < 9; }) == 6);
+	}
+
+	// Test 4: Fuzzy testing with a non-commutative monoid
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			int n = 1 + rng() % 40;
+			vector<pair<ll, ll>> arr(n, Affine::I);
+			MonoidTree<Affine> tree(n);
+			for (int op = 0; op < 50; op++) {
+				if (rng() % 2) {
+					int pos = rng() % n;
+					arr[pos] = {rng() % 10, rng() % 10};
+					tree.change(pos, arr[pos]);
+				} else {
+					int a = rng() % (n + 1), b = rng() % (n + 1);
+					if (a > b) swap(a, b);
+					auto expect = Affine::I;
+					for (int i = a; i < b; i++) expect = Affine::f(expect, arr[i]);
+					assert(tree.query(a, b) == expect);
+				}
+			}
+		}
+	}
+
+	// Test 5: Fuzzy testing max_right and min_left against brute force
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			int n = 1 + rng() % 40;
+			vector<int> arr(n);
+			MonoidTree<Sum> tree(n);
+			for (int i = 0; i < n; i++) tree.change(i, arr[i] = rng() % 10);
+			for (int q = 0; q < 20; q++) {
+				int x = rng() % (n + 1);
+				ll lim = rng() % 60;
+				auto g = [&](ll s) { return s <= lim; };
+				int r = x;
+				for (ll s = 0; r < n && s + arr[r] <= lim; r++) s += arr[r];
+				assert(tree.max_right(x, g) == r);
+				int l = x;
+				for (ll s = 0; l > 0 && s + arr[l - 1] <= lim; l--) s += arr[l - 1];
+				assert(tree.min_left(x, g) == l);
+			}
+		}
+	}
+
+	// Test 6: Concurrent readers
+	{
+		int n = 1000;
+		MonoidTree<Min> tree(n);
+		for (int i = 0; i < n; i++) tree.change(i, (i * 7919) % n);
+		vector<thread> th;
+		vector<int> bad(4);
+		for (int t = 0; t < 4; t++) {
+			th.emplace_back([&, t] {
+				for (int l = t; l < n; l += 4) {
+					int expect = INT_MAX;
+					for (int r = l + 1; r <= n; r++) {
+						expect = min(expect, (r - 1) * 7919 % n);
+						bad[t] += tree.query(l, r) != expect;
+					}
+				}
+			});
+		}
+		for (auto& t : th) t.join();
+		assert(bad == vector<int>(4));
+	}
+
+	// Test 7: Build from array and batched changes
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			int n = 1 + rng() % 40;
+			vector<pair<ll, ll>> arr(n);
+			for (auto& p : arr) p = {rng() % 10, rng() % 10};
+			MonoidTree<Affine> tree(arr), slow(n);
+			for (int i = 0; i < n; i++) slow.change(i, arr[i]);
+			assert(tree.t == slow.t);
+			for (int round = 0; round < 5; round++) {
+				vector<pair<int, pair<ll, ll>>> upd(rng() % 20);
+				for (auto& [k, x] : upd) {
+					k = rng() % n;
+					x = {rng() % 10, rng() % 10};
+					slow.change(k, x);
+				}
+				tree.change_many(upd);
+				assert(tree.t == slow.t);
+			}
+		}
+	}
+
+	// Test 8: Usable next to seg_tree.cpp's Tree (e.g. together with HLD)
+	{
+		vector<ll> a = {4, 1, 3, 2};
+		MonoidTree<Sum> mt(a);
+		Tree<ll> st(a, 0, [](ll x, ll y) { return x + y; });
+		for (int l = 0; l <= 4; l++) {
+			for (int r = l; r <= 4; r++) assert(mt.query(l, r) == st.query(l, r));
+		}
+	}
+
+	cout << "All monoid segment tree tests passed!" << endl;
+	return 0;
+}
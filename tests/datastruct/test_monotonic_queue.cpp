@@ -3,6 +3,7 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <random>
 
 using namespace std;
 
@@ -194,6 +195,25 @@ int main() {
 		assert(mq.get() == 100);
 	}
 
+	// Test 11: Ring buffer storage matches the deque version on sliding windows
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			int n = 1 + rng() % 300, k = 1 + rng() % 20;
+			vector<int> v(n);
+			for (auto& x : v) x = rng() % 50;
+			MonotonicQueue<int, less<int>> a;
+			MonotonicQueue<int, less<int>, RingDeque<pair<int, int>, 32>> b;
+			for (int i = 0; i < n; ++i) {
+				a.push(v[i]);
+				b.push(v[i]);
+				if (i >= k) a.pop(), b.pop();
+				assert(a.get() == b.get());
+				assert(b.get() == *min_element(v.begin() + max(0, i - k + 1), v.begin() + i + 1));
+			}
+		}
+	}
+
 	cout << "All Monotonic Queue tests passed!" << endl;
 	return 0;
 }
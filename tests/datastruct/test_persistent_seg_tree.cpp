@@ -0,0 +1,115 @@
+#include "../../datastruct/persistent_seg_tree.cpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: Historical queries
+	{
+		PersistentTree<> tree(vector<ll>{1, 2, 3, 4, 5});
+		int v1 = tree.update(0, 2, 10);  // 1 2 13 4 5
+		int v2 = tree.update(v1, 0, -1); // 0 2 13 4 5
+		int v3 = tree.update(0, 4, 5);   // 1 2 3 4 10
+
+		assert(tree.query(0, 0, 5) == 15);
+		assert(tree.query(v1, 0, 5) == 25);
+		assert(tree.query(v2, 0, 5) == 24);
+		assert(tree.query(v3, 0, 5) == 20);
+		assert(tree.query(v1, 2, 3) == 13);
+		assert(tree.query(v3, 2, 3) == 3);
+		assert(tree.query(v2, 1, 1) == 0);  // Empty range
+	}
+
+	// Test 2: Empty initial version, few nodes per update
+	{
+		PersistentTree<int> tree(1 << 10);
+		assert(tree.query(0, 0, 1 << 10) == 0);
+		int v = tree.update(0, 5, 1);
+		assert(tree.p.size() == 1 + 11);  // Null node plus one path
+		assert(tree.query(v, 5, 6) == 1);
+		assert(tree.query(v, 6, 1 << 10) == 0);
+	}
+
+	// Test 3: Build is linear
+	{
+		PersistentTree<int> tree(vector<int>(100, 1));
+		assert(tree.p.size() == 1 + 199);
+		assert(tree.query(0, 0, 100) == 100);
+	}
+
+	// Test 4: k-th smallest in a range by version differencing
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 50; test++) {
+			int n = 1 + rng() % 30, vals = 1 + rng() % 10;
+			vector<int> a(n);
+			for (auto& x : a) x = rng() % vals;
+			PersistentTree<int> tree(vals);
+			for (int i = 0; i < n; i++) tree.update(i, a[i], 1);  // Version i + 1 has a[0..i]
+			for (int q = 0; q < 20; q++) {
+				int l = rng() % n, r = l + 1 + rng() % (n - l);
+				vector<int> b(a.begin() + l, a.begin() + r);
+				sort(b.begin(), b.end());
+				int k = rng() % (r - l);
+				assert(tree.kth(l, r, k) == b[k]);
+				assert(tree.kth(l, r, r - l) == vals);
+			}
+		}
+	}
+
+	// Test 5: Compaction keeps answers and drops unreachable nodes
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 50; test++) {
+			int n = 1 + rng() % 20;
+			vector<vector<ll>> hist = {vector<ll>(n)};
+			for (auto& x : hist[0]) x = rng() % 10;
+			PersistentTree<> tree(hist[0]);
+			for (int op = 0; op < 30; op++) {
+				int v = rng() % hist.size(), k = rng() % n;
+				ll d = ll(rng() % 21) - 10;
+				hist.push_back(hist[v]);
+				hist.back()[k] += d;
+				tree.update(v, k, d);
+			}
+			vector<int> keep;
+			for (int v = 0; v < int(hist.size()); v++) {
+				if (rng() % 3 == 0) keep.push_back(v);
+			}
+			size_t before = tree.p.size();
+			tree.compact(keep);
+			assert(tree.p.size() <= before);
+			for (int i = 0; i < int(keep.size()); i++) {
+				for (int l = 0; l < n; l++) {
+					ll expect = 0;
+					for (int r = l + 1; r <= n; r++) {
+						expect += hist[keep[i]][r - 1];
+						assert(tree.query(i, l, r) == expect);
+					}
+				}
+			}
+			if (!keep.empty()) {
+				int v = tree.update(0, 0, 1);  // Still usable after compaction
+				assert(tree.query(v, 0, 1) == hist[keep[0]][0] + 1);
+			}
+		}
+	}
+
+	// Test 6: Compacting to a single version of a fresh update path
+	{
+		PersistentTree<int> tree(8);
+		int v = 0;
+		for (int i = 0; i < 8; i++) v = tree.update(v, i, 1);
+		tree.compact({v});
+		assert(tree.roots.size() == 1);
+		assert(tree.p.size() == 1 + 15);
+		assert(tree.query(0, 0, 8) == 8);
+	}
+
+	cout << "All persistent segment tree tests passed!" << endl;
+	return 0;
+}
@@ -161,6 +161,27 @@ int main() {
 		}
 	}
 
+	// Test 12: Batched argmin matches scalar argmin
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 50; test++) {
+			int n = 1 + rng() % 100;
+			vector<int> v(n);
+			for (auto& x : v) x = rng() % 50;
+			RMQ<int> rmq(v);
+			vector<pair<int, int>> q(rng() % 40);
+			for (auto& [l, r] : q) {
+				l = rng() % n;
+				r = l + rng() % (n - l);
+			}
+			for (int threads : {1, 3}) {
+				vector<int> out(q.size());
+				rmq.argmin_many(q, out, threads);
+				for (size_t i = 0; i < q.size(); i++) assert(out[i] == rmq.argmin(q[i].first, q[i].second));
+			}
+		}
+	}
+
 	cout << "All RMQ tests passed!" << endl;
 	return 0;
 }
@@ -0,0 +1,95 @@
+#include "../../datastruct/rollback_dsu.cpp"
+#include "../../datastruct/dsu.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: Basic operations
+	{
+		RollbackDSU dsu(5);
+		assert(!dsu.same(0, 1));
+		assert(dsu.merge(0, 1));
+		assert(dsu.same(0, 1));
+		assert(!dsu.merge(1, 0));  // Already connected
+		assert(dsu.size(0) == 2);
+		assert(dsu.size(2) == 1);
+	}
+
+	// Test 2: Rollback to an earlier snapshot
+	{
+		RollbackDSU dsu(6);
+		dsu.merge(0, 1);
+		int t = dsu.snapshot();
+		dsu.merge(1, 2);
+		dsu.merge(3, 4);
+		assert(dsu.same(0, 2));
+		assert(dsu.size(0) == 3);
+
+		dsu.rollback(t);
+		assert(dsu.same(0, 1));
+		assert(!dsu.same(0, 2));
+		assert(!dsu.same(3, 4));
+		assert(dsu.size(0) == 2);
+		assert(dsu.size(2) == 1);
+
+		dsu.rollback(0);
+		for (int i = 0; i < 6; ++i) assert(dsu.size(i) == 1);
+	}
+
+	// Test 3: Failed merges do not add history
+	{
+		RollbackDSU dsu(3);
+		dsu.merge(0, 1);
+		int t = dsu.snapshot();
+		dsu.merge(1, 0);
+		assert(dsu.snapshot() == t);
+	}
+
+	// Test 4: Union by size keeps chains short
+	{
+		RollbackDSU dsu(1 << 10);
+		for (int i = 0; i + 1 < (1 << 10); ++i) dsu.merge(i, i + 1);
+		for (int i = 0; i < (1 << 10); ++i) {
+			int d = 0;
+			for (int x = i; x != dsu.f[x]; x = dsu.f[x]) ++d;
+			assert(d <= 10);
+		}
+	}
+
+	// Test 5: Fuzzy testing, rollback equals rebuilding from scratch
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			int n = 1 + rng() % 20;
+			RollbackDSU dsu(n);
+			vector<pair<int, int>> ops;
+			vector<int> times;
+			for (int op = 0; op < 40; ++op) {
+				if (rng() % 4 == 0 && !times.empty()) {
+					int k = rng() % times.size();
+					dsu.rollback(times[k]);
+					ops.resize(k);
+					times.resize(k);
+				} else {
+					times.push_back(dsu.snapshot());
+					int x = rng() % n, y = rng() % n;
+					ops.push_back({x, y});
+					dsu.merge(x, y);
+				}
+				DSU naive(n);
+				for (auto [x, y] : ops) naive.merge(x, y);
+				for (int x = 0; x < n; ++x) {
+					assert(dsu.size(x) == naive.size(x));
+					for (int y = 0; y < n; ++y) assert(dsu.same(x, y) == naive.same(x, y));
+				}
+			}
+		}
+	}
+
+	cout << "All rollback DSU tests passed!" << endl;
+	return 0;
+}
@@ -210,6 +210,40 @@ int main() {
 		assert(sum1 + sum2 == tree.query(0, 5));
 	}
 
+	// Test 12: Build from array, size rounded up to a power of 2
+	{
+		vector<int> a = {5, 3, 7, 1, 9};
+		Tree<int> tree(a, INT_MAX, [](int a, int b) { return min(a, b); });
+		assert(tree.n == 8);
+		assert(tree.query(0, 5) == 1);
+		assert(tree.query(0, 3) == 3);
+		assert(tree.query(4, 8) == 9);
+	}
+
+	// Test 13: Fuzzy testing batched changes against single changes
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; test++) {
+			int n = 1 << (rng() % 7);
+			vector<int> arr(n);
+			for (auto& x : arr) x = rng() % 100;
+			auto sum = [](int a, int b) { return a + b; };
+			Tree<int> tree(arr, 0, sum), slow(n, 0, sum);
+			for (int i = 0; i < n; i++) slow.change(i, arr[i]);
+			assert(tree.t == slow.t);
+			for (int round = 0; round < 5; round++) {
+				vector<pair<int, int>> upd(rng() % 20);
+				for (auto& [k, x] : upd) {
+					k = rng() % n;
+					x = rng() % 100;
+					slow.change(k, x);
+				}
+				tree.change_many(upd);
+				assert(tree.t == slow.t);
+			}
+		}
+	}
+
 	cout << "All Segment Tree tests passed!" << endl;
 	return 0;
 }
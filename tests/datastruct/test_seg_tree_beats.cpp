@@ -0,0 +1,77 @@
+#include "../../datastruct/seg_tree_beats.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: Basic chmin, chmax, add
+	{
+		SegTreeBeats tree({5, 1, 8, 3, 9});
+		assert(tree.query(0, 5) == 26);
+		tree.chmin(0, 5, 6);   // 5 1 6 3 6
+		assert(tree.query(0, 5) == 21);
+		tree.chmax(1, 4, 4);   // 5 4 6 4 6
+		assert(tree.query(0, 5) == 25);
+		tree.add(2, 5, -10);   // 5 4 -4 -6 -4
+		assert(tree.query(0, 5) == -5);
+		assert(tree.query(2, 3) == -4);
+		assert(tree.query(3, 3) == 0);  // Empty range
+	}
+
+	// Test 2: Single element
+	{
+		SegTreeBeats tree({7});
+		tree.chmin(0, 1, 3);
+		tree.chmax(0, 1, 5);
+		tree.add(0, 1, 2);
+		assert(tree.query(0, 1) == 7);
+	}
+
+	// Test 3: All equal values, chmin hits the min side too
+	{
+		SegTreeBeats tree(vector<ll>(6, 10));
+		tree.chmin(0, 6, 4);
+		assert(tree.query(0, 6) == 24);
+		tree.chmax(2, 4, 8);  // 4 4 8 8 4 4
+		assert(tree.query(0, 6) == 32);
+		tree.chmin(0, 6, 5);  // 4 4 5 5 4 4
+		assert(tree.query(0, 6) == 26);
+	}
+
+	// Test 4: Fuzzy testing against brute force
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 200; test++) {
+			int n = 1 + rng() % 30;
+			vector<ll> arr(n);
+			for (auto& x : arr) x = ll(rng() % 41) - 20;
+			SegTreeBeats tree(arr);
+			for (int op = 0; op < 60; op++) {
+				int l = rng() % (n + 1), r = rng() % (n + 1);
+				if (l > r) swap(l, r);
+				ll v = ll(rng() % 41) - 20;
+				int type = rng() % 4;
+				if (type == 0) {
+					for (int i = l; i < r; i++) arr[i] = min(arr[i], v);
+					tree.chmin(l, r, v);
+				} else if (type == 1) {
+					for (int i = l; i < r; i++) arr[i] = max(arr[i], v);
+					tree.chmax(l, r, v);
+				} else if (type == 2) {
+					for (int i = l; i < r; i++) arr[i] += v;
+					tree.add(l, r, v);
+				} else {
+					ll expect = 0;
+					for (int i = l; i < r; i++) expect += arr[i];
+					assert(tree.query(l, r) == expect);
+				}
+			}
+		}
+	}
+
+	cout << "All segment tree beats tests passed!" << endl;
+	return 0;
+}
@@ -0,0 +1,105 @@
+#include "../../datastruct/sliding_window.cpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using ll = long long;
+
+struct Gcd {
+	using T = ll;
+	static constexpr T I = 0;
+	static T f(T a, T b) { return gcd(a, b); }
+};
+
+// x -> first * x + second mod P, applied left to right; not commutative
+const ll P = 998244353;
+struct Affine {
+	using T = pair<ll, ll>;
+	static constexpr T I = {1, 0};
+	static T f(T p, T q) { return {p.first * q.first % P, (p.second * q.first + q.second) % P}; }
+};
+
+int main() {
+	// Test 1: Basic gcd window
+	{
+		SlidingWindow<Gcd> w;
+		assert(w.empty());
+		assert(w.get() == 0);
+		w.push(12);
+		w.push(18);
+		assert(w.get() == 6);
+		w.push(9);
+		assert(w.get() == 3);
+		w.pop();
+		assert(w.get() == 9);
+		w.pop();
+		assert(w.get() == 9);
+		assert(w.size() == 1);
+		w.pop();
+		assert(w.empty());
+	}
+
+	// Test 2: Growing past the initial capacity keeps the order
+	{
+		SlidingWindow<Affine> w(1);
+		auto expect = Affine::I;
+		for (int i = 0; i < 100; ++i) {
+			pair<ll, ll> x = {i % 7 + 1, i % 5};
+			w.push(x);
+			expect = Affine::f(expect, x);
+		}
+		assert(w.get() == expect);
+		assert(w.size() == 100);
+	}
+
+	// Test 3: Fuzzy testing against brute force with a non-commutative monoid
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			SlidingWindow<Affine> w(1 + rng() % 8);
+			vector<pair<ll, ll>> q;
+			size_t head = 0;
+			for (int op = 0; op < 200; ++op) {
+				if (rng() % 3) {
+					pair<ll, ll> x = {rng() % 10, rng() % 10};
+					w.push(x);
+					q.push_back(x);
+				} else if (head < q.size()) {
+					w.pop();
+					++head;
+				}
+				auto expect = Affine::I;
+				for (size_t i = head; i < q.size(); ++i) expect = Affine::f(expect, q[i]);
+				assert(w.get() == expect);
+				assert(w.size() == int(q.size() - head));
+			}
+		}
+	}
+
+	// Test 4: Fixed-size sliding window over a long stream
+	{
+		mt19937 rng(42);
+		int n = 10000, k = 50;
+		vector<ll> v(n);
+		for (auto& x : v) x = 6 * (1 + rng() % 100);
+		SlidingWindow<Gcd> w(k);
+		for (int i = 0; i < n; ++i) {
+			w.push(v[i]);
+			if (i >= k) w.pop();
+			if (i % 997 == 0) {
+				ll expect = 0;
+				for (int j = max(0, i - k + 1); j <= i; ++j) expect = gcd(expect, v[j]);
+				assert(w.get() == expect);
+			}
+		}
+		assert(w.val.size() == 64);  // Never grew past the window
+	}
+
+	cout << "All sliding window tests passed!" << endl;
+	return 0;
+}
@@ -0,0 +1,67 @@
+#include "../../datastruct/sparse_dsu.cpp"
+#include "../../datastruct/dsu.cpp"
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: Basic operations on huge keys
+	{
+		SparseDSU dsu;
+		uint64_t a = 1ULL << 62, b = ~0ULL, c = 0;
+		assert(!dsu.same(a, b));
+		assert(dsu.merge(a, b));
+		assert(dsu.same(b, a));
+		assert(!dsu.same(a, c));
+		assert(!dsu.merge(b, a));  // Already connected
+		assert(dsu.size(a) == 2);
+		assert(dsu.size(c) == 1);
+		assert(dsu.count() == 3);
+	}
+
+	// Test 2: Slot ids are stable and dense
+	{
+		SparseDSU dsu;
+		assert(dsu.id(100) == 0);
+		assert(dsu.id(7) == 1);
+		assert(dsu.id(100) == 0);
+		assert(dsu.count() == 2);
+	}
+
+	// Test 3: Growing far past the initial table
+	{
+		SparseDSU dsu;
+		for (uint64_t i = 0; i < 10000; ++i) dsu.merge(i * 1000003, (i + 1) * 1000003);
+		assert(dsu.count() == 10001);
+		assert(dsu.size(0) == 10001);
+		assert(dsu.same(0, 10000ULL * 1000003));
+		for (uint64_t i = 0; i <= 10000; ++i) assert(dsu.id(i * 1000003) == int(i));
+	}
+
+	// Test 4: Fuzzy testing against DSU over compressed keys
+	{
+		mt19937_64 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			int n = 1 + rng() % 30;
+			vector<uint64_t> pool(n);
+			for (auto& x : pool) x = rng();
+			map<uint64_t, int> comp;
+			for (auto x : pool) comp.emplace(x, int(comp.size()));
+			DSU naive(int(comp.size()));
+			SparseDSU dsu(int(rng() % 4));
+			for (int op = 0; op < 50; ++op) {
+				uint64_t x = pool[rng() % n], y = pool[rng() % n];
+				if (rng() % 2) assert(dsu.merge(x, y) == naive.merge(comp[x], comp[y]));
+				else assert(dsu.same(x, y) == naive.same(comp[x], comp[y]));
+				assert(dsu.size(x) == naive.size(comp[x]));
+			}
+		}
+	}
+
+	cout << "All sparse DSU tests passed!" << endl;
+	return 0;
+}
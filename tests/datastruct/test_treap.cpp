@@ -1,6 +1,12 @@
 #include "../../datastruct/treap.cpp"
 #include <cassert>
+#include <climits>
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <set>
+#include <vector>
 
 using namespace std;
 
@@ -203,6 +209,85 @@ int main() {
 		assert(root != nullptr);
 	}
 
+	// Test 15: Linear build keeps order and heap property
+	{
+		vector<int> keys(1000);
+		for (int i = 0; i < 1000; i++) keys[i] = 3 * i;
+		Treap* root = Treap::build(keys);
+		assert(Treap::size(root) == 1000);
+		assert(Treap::build({}) == nullptr);
+
+		vector<int> seen;
+		function<void(Treap*)> dfs = [&](Treap* t) {
+			if (t == nullptr) return;
+			for (Treap* c : {t->l, t->r}) {
+				if (c != nullptr) assert(c->prior >= t->prior);
+			}
+			assert(t->sz == 1 + Treap::size(t->l) + Treap::size(t->r));
+			dfs(t->l);
+			seen.push_back(t->v);
+			dfs(t->r);
+		};
+		dfs(root);
+		assert(seen == keys);
+
+		// Positional split still works on a built treap
+		auto [lo, hi] = Treap::split(root, 400);
+		assert(Treap::size(lo) == 400 && Treap::size(hi) == 600);
+	}
+
+	// Test 16: Set operations against std::set, including the parallel path
+	{
+		mt19937 rng(42);
+		auto to_vec = [](Treap* t) {
+			vector<int> res;
+			function<void(Treap*)> dfs = [&](Treap* u) {
+				if (u == nullptr) return;
+				dfs(u->l);
+				res.push_back(u->v);
+				dfs(u->r);
+			};
+			dfs(t);
+			return res;
+		};
+		auto random_set = [&](int n, int range) {
+			set<int> s;
+			while ((int)s.size() < n) s.insert(rng() % range);
+			return vector<int>(s.begin(), s.end());
+		};
+		for (int test = 0; test < 60; test++) {
+			int n = test < 50 ? rng() % 50 : 40000, m = test < 50 ? rng() % 50 : 30000;
+			int range = test < 50 ? 100 : 100000;
+			vector<int> x = random_set(n, range), y = random_set(m, range);
+			vector<int> u, in, d;
+			set_union(x.begin(), x.end(), y.begin(), y.end(), back_inserter(u));
+			set_intersection(x.begin(), x.end(), y.begin(), y.end(), back_inserter(in));
+			set_difference(x.begin(), x.end(), y.begin(), y.end(), back_inserter(d));
+
+			assert(to_vec(Treap::unite(Treap::build(x), Treap::build(y))) == u);
+			assert(to_vec(Treap::intersect(Treap::build(x), Treap::build(y))) == in);
+			Treap* diff = Treap::difference(Treap::build(x), Treap::build(y));
+			assert(to_vec(diff) == d && Treap::size(diff) == (int)d.size());
+		}
+
+		// Keys at the top of the int range
+		assert(Treap::size(Treap::unite(Treap::build({1, INT_MAX}), Treap::build({INT_MAX}))) == 2);
+		assert(to_vec(Treap::intersect(Treap::build({INT_MAX}), Treap::build({INT_MAX}))) == vector<int>{INT_MAX});
+		assert(Treap::difference(Treap::build({INT_MAX}), Treap::build({INT_MAX})) == nullptr);
+		assert(to_vec(Treap::unite(Treap::build({INT_MIN, 0}), Treap::build({INT_MIN, INT_MAX}))) == vector<int>({INT_MIN, 0, INT_MAX}));
+	}
+
+	// Test 17: split_key
+	{
+		Treap* root = Treap::build({1, 3, 5, 7, 9});
+		auto [a, b] = Treap::split_key(root, 5);
+		assert(Treap::size(a) == 2 && Treap::size(b) == 3);
+		auto [c, d] = Treap::split_key(b, 100);
+		assert(Treap::size(c) == 3 && d == nullptr);
+		auto [e, f] = Treap::split_key(Treap::merge(a, c), 5, true);
+		assert(Treap::size(e) == 3 && Treap::size(f) == 2);
+	}
+
 	cout << "All Treap tests passed!" << endl;
 	return 0;
 }
@@ -0,0 +1,109 @@
+#include "../../datastruct/wide_seg_tree.cpp"
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+using ll = long long;
+
+struct Sum {
+	using T = ll;
+	static constexpr T I = 0;
+	static T f(T a, T b) { return a + b; }
+};
+
+struct Min {
+	using T = int;
+	static constexpr T I = INT_MAX;
+	static T f(T a, T b) { return min(a, b); }
+};
+
+// Not commutative: keeps the first non-zero value
+struct First {
+	using T = int;
+	static constexpr T I = 0;
+	static T f(T a, T b) { return a ? a : b; }
+};
+
+template<class M>
+void fuzz(int maxn, auto gen) {
+	mt19937 rng(42);
+	for (int test = 0; test < 100; test++) {
+		int n = 1 + rng() % maxn;
+		vector<typename M::T> arr(n);
+		for (auto& x : arr) x = gen(rng);
+		WideTree<M> tree(arr);
+		for (int op = 0; op < 50; op++) {
+			if (rng() % 3 == 0) {
+				int pos = rng() % n;
+				arr[pos] = gen(rng);
+				tree.change(pos, arr[pos]);
+			} else {
+				int a = rng() % (n + 1), b = rng() % (n + 1);
+				if (a > b) swap(a, b);
+				auto expect = M::I;
+				for (int i = a; i < b; i++) expect = M::f(expect, arr[i]);
+				assert(tree.query(a, b) == expect);
+			}
+		}
+	}
+}
+
+int main() {
+	// Test 1: Basic sum and min
+	{
+		WideTree<Sum> sum(vector<ll>{1, 2, 3, 4, 5});
+		assert(sum.query(0, 5) == 15);
+		assert(sum.query(1, 4) == 9);
+		assert(sum.query(2, 2) == 0);
+
+		WideTree<Min> mn(5);
+		assert(mn.query(0, 5) == INT_MAX);
+		mn.change(3, 7);
+		mn.change(1, 9);
+		assert(mn.query(0, 5) == 7);
+		assert(mn.query(0, 3) == 9);
+	}
+
+	// Test 2: Single element
+	{
+		WideTree<Sum> tree(1);
+		tree.change(0, 42);
+		assert(tree.query(0, 1) == 42);
+		assert(tree.off.size() == 2);
+	}
+
+	// Test 3: Nodes are cache line aligned
+	{
+		WideTree<Min> tree(1000);
+		assert(sizeof(WideTree<Min>::Node) == 64);
+		assert(reinterpret_cast<size_t>(tree.t.data()) % 64 == 0);
+	}
+
+	// Test 4: Several levels, queries across level boundaries
+	{
+		int n = 5000;
+		vector<ll> a(n);
+		for (int i = 0; i < n; i++) a[i] = i;
+		WideTree<Sum> tree(a);
+		assert(tree.off.size() >= 4);
+		for (int l = 0; l < n; l += 97) {
+			for (int r = l; r <= n; r += 89) {
+				assert(tree.query(l, r) == 1LL * (l + r - 1) * (r - l) / 2);
+			}
+		}
+	}
+
+	// Test 5: Fuzzy testing against brute force
+	{
+		fuzz<Sum>(300, [](mt19937& rng) { return ll(rng() % 1000) - 500; });
+		fuzz<Min>(300, [](mt19937& rng) { return int(rng() % 1000); });
+		fuzz<First>(300, [](mt19937& rng) { return int(rng() % 3); });
+	}
+
+	cout << "All wide segment tree tests passed!" << endl;
+	return 0;
+}
@@ -0,0 +1,78 @@
+#include "../../graph/connected_components.cpp"
+#include "../../datastruct/dsu.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// Naive labels numbered by smallest vertex, like connected_components
+vector<int> naive_labels(int n, const vector<pair<int, int>>& edges) {
+	DSU dsu(n);
+	for (auto [u, v] : edges) dsu.merge(u, v);
+	vector<int> id(n, -1), ret(n);
+	int k = 0;
+	for (int i = 0; i < n; ++i) {
+		int r = dsu.root(i);
+		if (id[r] < 0) id[r] = k++;
+		ret[i] = id[r];
+	}
+	return ret;
+}
+
+int main() {
+	// Test 1: Empty graph
+	{
+		vector<int> label;
+		assert(connected_components(0, {}, label) == 0);
+	}
+
+	// Test 2: No edges
+	{
+		vector<int> label(4);
+		assert(connected_components(4, {}, label) == 4);
+		assert((label == vector<int>{0, 1, 2, 3}));
+	}
+
+	// Test 3: Small example
+	{
+		vector<pair<int, int>> edges = {{4, 2}, {1, 3}, {3, 5}, {0, 0}};
+		vector<int> label(6);
+		assert(connected_components(6, edges, label) == 3);
+		assert((label == vector<int>{0, 1, 2, 1, 2, 1}));
+	}
+
+	// Test 4: Fuzzy testing with different thread counts
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			int n = 1 + rng() % 50;
+			int m = rng() % 60;
+			vector<pair<int, int>> edges(m);
+			for (auto& [u, v] : edges) u = rng() % n, v = rng() % n;
+			auto expect = naive_labels(n, edges);
+			int k = *max_element(expect.begin(), expect.end()) + 1;
+			for (int threads : {1, 2, 4}) {
+				vector<int> label(n);
+				assert(connected_components(n, edges, label, threads) == k);
+				assert(label == expect);
+			}
+		}
+	}
+
+	// Test 5: One giant component plus isolated vertices
+	{
+		mt19937 rng(42);
+		int n = 5000;
+		vector<pair<int, int>> edges;
+		for (int i = 1; i < 4000; ++i) edges.push_back({int(rng() % i), i});
+		shuffle(edges.begin(), edges.end(), rng);
+		vector<int> label(n);
+		assert(connected_components(n, edges, label, 4) == 1001);
+		assert(label == naive_labels(n, edges));
+	}
+
+	cout << "All connected components tests passed!" << endl;
+	return 0;
+}
@@ -0,0 +1,93 @@
+#include "../../graph/dynamic_connectivity.cpp"
+#include "../../datastruct/dsu.cpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main() {
+	// Test 1: No queries
+	{
+		DynamicConnectivity dc(3);
+		dc.addedge(0, 1);
+		assert(dc.run().empty());
+	}
+
+	// Test 2: Add, query, remove, query
+	{
+		DynamicConnectivity dc(4);
+		dc.query(0, 1);
+		dc.addedge(0, 1);
+		dc.addedge(1, 2);
+		dc.query(0, 2);
+		dc.removeedge(1, 0);  // Either endpoint order
+		dc.query(0, 2);
+		dc.query(1, 2);
+		dc.query(3, 3);
+		auto ans = dc.run();
+		assert((ans == vector<bool>{false, true, false, true, true}));
+	}
+
+	// Test 3: Multi-edges, removing one copy keeps the other
+	{
+		DynamicConnectivity dc(2);
+		dc.addedge(0, 1);
+		dc.addedge(0, 1);
+		dc.removeedge(0, 1);
+		dc.query(0, 1);
+		dc.removeedge(0, 1);
+		dc.query(0, 1);
+		auto ans = dc.run();
+		assert((ans == vector<bool>{true, false}));
+	}
+
+	// Test 4: Fuzzy testing against rebuilding DSU per query
+	{
+		mt19937 rng(42);
+		for (int test = 0; test < 100; ++test) {
+			int n = 1 + rng() % 10;
+			DynamicConnectivity dc(n);
+			vector<pair<int, int>> edges;
+			vector<bool> expect;
+			for (int op = 0; op < 60; ++op) {
+				int t = rng() % 3;
+				if (t == 0) {
+					int u = rng() % n, v = rng() % n;
+					dc.addedge(u, v);
+					edges.push_back({u, v});
+				} else if (t == 1 && !edges.empty()) {
+					int k = rng() % edges.size();
+					dc.removeedge(edges[k].first, edges[k].second);
+					edges.erase(edges.begin() + k);
+				} else {
+					int u = rng() % n, v = rng() % n;
+					dc.query(u, v);
+					DSU dsu(n);
+					for (auto [a, b] : edges) dsu.merge(a, b);
+					expect.push_back(dsu.same(u, v));
+				}
+			}
+			assert(dc.run() == expect);
+		}
+	}
+
+	// Test 5: run() can be called again after logging more operations
+	{
+		DynamicConnectivity dc(4);
+		dc.addedge(0, 1);
+		dc.addedge(1, 2);
+		dc.query(0, 2);
+		assert(dc.run() == vector<bool>({true}));
+		assert(dc.run() == vector<bool>({true}));
+		dc.query(0, 2);
+		dc.removeedge(1, 2);
+		dc.query(0, 2);
+		dc.query(0, 1);
+		assert(dc.run() == vector<bool>({true, true, false, true}));
+	}
+
+	cout << "All dynamic connectivity tests passed!" << endl;
+	return 0;
+}